@@ -14,6 +14,8 @@ DEFINES += RANDLIB_LIBRARY
 SOURCES += \
     distributions/ProbabilityDistribution.cpp \
     distributions/univariate/BasicRandGenerator.cpp \
+    distributions/univariate/MultiStreamRandEngine.cpp \
+    distributions/univariate/CounterRandEngine.cpp \
     distributions/univariate/continuous/BetaRand.cpp \
     distributions/univariate/continuous/CauchyRand.cpp \
     distributions/univariate/continuous/ExponentialRand.cpp \
@@ -67,11 +69,13 @@ SOURCES += \
     distributions/univariate/discrete/NegativeHyperGeometricRand.cpp \
     distributions/univariate/continuous/InverseGaussianRand.cpp \
     distributions/univariate/discrete/CategoricalRand.cpp \
+    distributions/univariate/discrete/DynamicCategoricalRand.cpp \
     distributions/univariate/continuous/NoncentralChiSquaredRand.cpp \
     distributions/univariate/continuous/KolmogorovSmirnovRand.cpp \
     math/BetaMath.cpp \
     math/GammaMath.cpp \
-    math/NumericMath.cpp \
+    math/VectorMath.cpp \
+    parallel/Executor.cpp \
     distributions/univariate/continuous/MarchenkoPasturRand.cpp \
     distributions/bivariate/ContinuousBivariateDistribution.cpp \
     distributions/bivariate/DiscreteBivariateDistribution.cpp \
@@ -86,6 +90,8 @@ SOURCES += \
 HEADERS +=\
     distributions/ProbabilityDistribution.h \
     distributions/univariate/BasicRandGenerator.h \
+    distributions/univariate/MultiStreamRandEngine.h \
+    distributions/univariate/CounterRandEngine.h \
     distributions/univariate/continuous/BetaRand.h \
     distributions/univariate/continuous/CauchyRand.h \
     distributions/univariate/continuous/ExponentialRand.h \
@@ -142,11 +148,14 @@ HEADERS +=\
     distributions/univariate/discrete/NegativeHyperGeometricRand.h \
     distributions/univariate/continuous/InverseGaussianRand.h \
     distributions/univariate/discrete/CategoricalRand.h \
+    distributions/univariate/discrete/DynamicCategoricalRand.h \
     distributions/univariate/continuous/NoncentralChiSquaredRand.h \
     distributions/univariate/continuous/KolmogorovSmirnovRand.h \
     math/BetaMath.h \
     math/GammaMath.h \
     math/NumericMath.h \
+    math/VectorMath.h \
+    parallel/Executor.h \
     RandLib_global.h \
     distributions/univariate/continuous/MarchenkoPasturRand.h \
     distributions/bivariate/ContinuousBivariateDistribution.h \
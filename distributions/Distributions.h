@@ -3,6 +3,8 @@
 
 #include "ProbabilityDistribution.h"
 #include "univariate/BasicRandGenerator.h"
+#include "univariate/MultiStreamRandEngine.h"
+#include "univariate/CounterRandEngine.h"
 
 /// UNIVARIATE
 #include "univariate/UnivariateDistribution.h"
@@ -53,6 +55,7 @@
 #include "univariate/discrete/BetaBinomialRand.h"
 #include "univariate/discrete/BinomialRand.h"
 #include "univariate/discrete/CategoricalRand.h"
+#include "univariate/discrete/DynamicCategoricalRand.h"
 #include "univariate/discrete/GeometricRand.h"
 #include "univariate/discrete/HyperGeometricRand.h"
 #include "univariate/discrete/NegativeBinomialRand.h"
@@ -24,7 +24,13 @@ void ProbabilityDistribution<T>::CumulativeDistributionFunction(const std::vecto
     size_t size = x.size();
     if (size > y.size())
         return;
-    for (size_t i = 0; i != size; ++i)
+    this->cdfBatch(x.data(), y.data(), size);
+}
+
+template < typename T >
+void ProbabilityDistribution<T>::cdfBatch(const T *x, double *y, size_t n) const
+{
+    for (size_t i = 0; i != n; ++i)
         y[i] = this->F(x[i]);
 }
 
@@ -40,7 +46,13 @@ void ProbabilityDistribution<T>::SurvivalFunction(const std::vector<T> &x, std::
     size_t size = x.size();
     if (size > y.size())
         return;
-    for (size_t i = 0; i != size; ++i)
+    this->cdfComplBatch(x.data(), y.data(), size);
+}
+
+template < typename T >
+void ProbabilityDistribution<T>::cdfComplBatch(const T *x, double *y, size_t n) const
+{
+    for (size_t i = 0; i != n; ++i)
         y[i] = this->S(x[i]);
 }
 
@@ -57,6 +69,12 @@ void ProbabilityDistribution<T>::Reseed(unsigned long seed) const
     this->localRandGenerator.Reseed(seed);
 }
 
+template < typename T >
+void ProbabilityDistribution<T>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+}
+
 template < typename T >
 constexpr char ProbabilityDistribution<T>::POSITIVITY_VIOLATION[];
 template < typename T >
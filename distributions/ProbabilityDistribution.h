@@ -5,6 +5,8 @@
 
 #include "math/RandMath.h"
 #include "math/NumericMath.h"
+#include "math/VectorMath.h"
+#include "parallel/Executor.h"
 #include "univariate/BasicRandGenerator.h"
 #include "RandLib_global.h"
 
@@ -98,7 +100,34 @@ public:
      */
     virtual void Reseed(unsigned long seed) const;
 
+    /**
+     * @fn Discard
+     * skip variatesNum variates in every generator, used by the distribution
+     * @param variatesNum
+     */
+    virtual void Discard(unsigned long long variatesNum) const;
+
 protected:
+    /**
+     * @fn cdfBatch
+     * fills y[i] = F(x[i]) for i = 0, ..., n - 1, called once by CumulativeDistributionFunction.
+     * Distributions with closed-form F override it by a loop without virtual calls,
+     * which copies parameters to locals first (stores to y might alias members otherwise)
+     * @param x
+     * @param y
+     * @param n
+     */
+    virtual void cdfBatch(const T *x, double *y, size_t n) const;
+
+    /**
+     * @fn cdfComplBatch
+     * fills y[i] = S(x[i]) for i = 0, ..., n - 1, called once by SurvivalFunction
+     * @param x
+     * @param y
+     * @param n
+     */
+    virtual void cdfComplBatch(const T *x, double *y, size_t n) const;
+
     enum FIT_ERROR_TYPE {
         WRONG_SAMPLE,
         NOT_APPLICABLE,
@@ -116,4 +145,42 @@ protected:
     String fitErrorDescription(FIT_ERROR_TYPE fet, const String &explanation);
 };
 
+/**
+ * @fn ParallelSample
+ * fills outputData concurrently: chunk c of chunkSize elements is filled by Sample
+ * of a copy of the distribution, which generators are moved c * 2^40 variates ahead.
+ * Hence the output depends only on the state of generators and the chunk size,
+ * but not on the executor, as long as sampling doesn't use static generators.
+ * Afterwards generators of the distribution skip all chunks
+ * @param distribution
+ * @param outputData
+ * @param chunkSize
+ * @param executor
+ */
+template < class Distribution, typename T >
+void ParallelSample(const Distribution &distribution, std::vector<T> &outputData, size_t chunkSize = 65536, Executor &executor = Executor::Default())
+{
+    /// chunks fit in the same 2^63 variates, which separate generators after Split
+    static constexpr unsigned long long CHUNK_DISTANCE = 1ULL << 40;
+    static constexpr size_t MAX_CHUNKS_NUM = 1ULL << 23;
+    if (chunkSize == 0)
+        throw std::invalid_argument("Parallel sample: chunk size should be positive");
+    size_t size = outputData.size();
+    size_t chunksNum = (size + chunkSize - 1) / chunkSize;
+    if (chunksNum > MAX_CHUNKS_NUM)
+        throw std::invalid_argument("Parallel sample: chunk size is too small for given amount of elements");
+
+    executor.ParallelFor(chunksNum, [&distribution, &outputData, chunkSize, size] (size_t chunk)
+    {
+        static thread_local std::vector<T> buffer;
+        Distribution chunkDistribution(distribution);
+        chunkDistribution.Discard(chunk * CHUNK_DISTANCE);
+        size_t start = chunk * chunkSize;
+        buffer.resize(std::min(chunkSize, size - start));
+        chunkDistribution.Sample(buffer);
+        std::copy(buffer.begin(), buffer.end(), outputData.begin() + start);
+    });
+    distribution.Discard(chunksNum * CHUNK_DISTANCE);
+}
+
 #endif // PROBABILITY_DISTRIBUTION_H
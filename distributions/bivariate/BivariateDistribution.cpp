@@ -12,6 +12,14 @@ void BivariateDistribution<T1, T2, T>::Reseed(unsigned long seed) const
     Y.Reseed(seed + 2);
 }
 
+template < class T1, class T2, typename T >
+void BivariateDistribution<T1, T2, T>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    X.Discard(variatesNum);
+    Y.Discard(variatesNum);
+}
+
 template < class T1, class T2, typename T >
 LongDoublePair BivariateDistribution<T1, T2, T>::Mean() const
 {
@@ -22,6 +22,7 @@ public:
     Pair<T> MaxValue() const { return Pair<T>(X.MaxValue(), Y.MaxValue()); }
 
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     virtual LongDoublePair Mean() const final;
     virtual LongDoubleTriplet Covariance() const final;
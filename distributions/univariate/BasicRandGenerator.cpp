@@ -5,6 +5,118 @@
 #include <time.h>
 #include <iostream>
 #include <thread>
+#include <array>
+#include <utility>
+
+namespace
+{
+
+/**
+ * @fn lcgJump
+ * Brown's algorithm: coefficients of x -> mult * x + inc after n steps
+ * @param mult
+ * @param inc
+ * @param n
+ * @return pair (A, C), such that n steps of the generator equal x -> A * x + C mod 2^64
+ */
+std::pair<unsigned long long, unsigned long long> lcgJump(unsigned long long mult, unsigned long long inc, unsigned long long n)
+{
+    unsigned long long accMult = 1, accInc = 0;
+    while (n > 0) {
+        if (n & 1) {
+            accMult *= mult;
+            accInc = accInc * mult + inc;
+        }
+        inc *= mult + 1;
+        mult *= mult;
+        n >>= 1;
+    }
+    return std::make_pair(accMult, accInc);
+}
+
+/**
+ * @fn mulMod
+ * @param a < m
+ * @param b < m
+ * @param m
+ * @return a * b mod m without overflow
+ */
+unsigned long long mulMod(unsigned long long a, unsigned long long b, unsigned long long m)
+{
+    unsigned long long result = 0;
+    while (b > 0) {
+        if (b & 1)
+            result = (result >= m - a) ? result - (m - a) : result + a;
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+}
+
+/**
+ * @fn mwcJump
+ * Multiply-with-carry generator with base 2^32 is a multiplicative
+ * congruential generator x -> a * x mod (a * 2^32 - 1) on x = c * 2^32 + z
+ * @param a multiplier
+ * @param z
+ * @param c carry
+ * @param n
+ */
+void mwcJump(unsigned long long a, unsigned int &z, unsigned int &c, unsigned long long n)
+{
+    const unsigned long long m = (a << 32) - 1;
+    unsigned long long x = (static_cast<unsigned long long>(c) << 32) + z;
+    unsigned long long power = a;
+    while (n > 0) {
+        if (n & 1)
+            x = mulMod(x, power, m);
+        power = mulMod(power, power, m);
+        n >>= 1;
+    }
+    z = x;
+    c = x >> 32;
+}
+
+/**
+ * @fn xorshiftJump
+ * Xorshift is linear over GF(2), so n steps are the n-th power of its matrix
+ * @param y
+ * @param n
+ * @param step single step of the generator
+ * @return state after n steps
+ */
+template < typename UIntType, class Step >
+UIntType xorshiftJump(UIntType y, unsigned long long n, Step step)
+{
+    static constexpr size_t BITS = 8 * sizeof(UIntType);
+    /// matrix is kept as columns: images of the unit vectors
+    typedef std::array<UIntType, BITS> Matrix;
+    /// selection by mask instead of branches, which random bits would mispredict
+    auto apply = [] (const Matrix &columns, UIntType vector) {
+        UIntType result = 0;
+        for (size_t i = 0; i != BITS; ++i)
+            result ^= columns[i] & (static_cast<UIntType>(0) - ((vector >> i) & 1));
+        return result;
+    };
+    /// matrices of 2^k steps don't depend on the state, hence they are computed once
+    static const std::array<Matrix, 64> powers = [&step, &apply] () {
+        std::array<Matrix, 64> matrices{};
+        for (size_t i = 0; i != BITS; ++i)
+            matrices[0][i] = step(static_cast<UIntType>(1) << i);
+        for (size_t k = 1; k != 64; ++k) {
+            for (size_t i = 0; i != BITS; ++i)
+                matrices[k][i] = apply(matrices[k - 1], matrices[k - 1][i]);
+        }
+        return matrices;
+    }();
+    for (size_t k = 0; n != 0; ++k, n >>= 1) {
+        if (n & 1)
+            y = apply(powers[k], y);
+    }
+    return y;
+}
+
+}
 
 unsigned long RandEngine::mix(unsigned long a, unsigned long b, unsigned long c)
 {
@@ -34,21 +146,41 @@ void JKissRandEngine::Reseed(unsigned long seed)
     Z = 43219876;
 }
 
-unsigned long long JKissRandEngine::Next()
+void JKissRandEngine::Fill(unsigned long long *output, size_t n)
 {
-    unsigned long long t = 698769069ULL * Z + C;
-
-    X *= 69069;
-    X += 12345;
-
-    Y ^= Y << 13;
-    Y ^= Y >> 17;
-    Y ^= Y << 5;
+    /// keep the state in registers for the whole block
+    unsigned int x = X, c = C, y = Y, z = Z;
+    for (size_t i = 0; i != n; ++i) {
+        unsigned long long t = 698769069ULL * z + c;
+        x = 69069 * x + 12345;
+        y ^= y << 13;
+        y ^= y >> 17;
+        y ^= y << 5;
+        c = t >> 32;
+        z = t;
+        output[i] = static_cast<unsigned int>(x + y + z);
+    }
+    X = x; C = c; Y = y; Z = z;
+}
 
-    C = t >> 32;
-    Z = t;
+void JKissRandEngine::Discard(unsigned long long n)
+{
+    auto [mult, inc] = lcgJump(69069, 12345, n);
+    X = mult * X + inc;
+    Y = xorshiftJump<unsigned int>(Y, n, [] (unsigned int y) {
+        y ^= y << 13;
+        y ^= y >> 17;
+        y ^= y << 5;
+        return y;
+    });
+    mwcJump(698769069ULL, Z, C, n);
+}
 
-    return X + Y + Z;
+JKissRandEngine JKissRandEngine::Split()
+{
+    JKissRandEngine child(*this);
+    Discard(SPLIT_DISTANCE);
+    return child;
 }
 
 void JLKiss64RandEngine::Reseed(unsigned long seed)
@@ -61,20 +193,46 @@ void JLKiss64RandEngine::Reseed(unsigned long seed)
     C2 = 1732654;
 }
 
-unsigned long long JLKiss64RandEngine::Next()
+void JLKiss64RandEngine::Fill(unsigned long long *output, size_t n)
+{
+    /// keep the state in registers for the whole block
+    unsigned long long x = X, y = Y;
+    unsigned int z1 = Z1, z2 = Z2, c1 = C1, c2 = C2;
+    for (size_t i = 0; i != n; ++i) {
+        x = 1490024343005336237ULL * x + 123456789;
+        y ^= y << 21;
+        y ^= y >> 17;
+        y ^= y << 30;
+        unsigned long long t = 4294584393ULL * z1 + c1;
+        c1 = t >> 32;
+        z1 = t;
+        t = 4246477509ULL * z2 + c2;
+        c2 = t >> 32;
+        z2 = t;
+        output[i] = x + y + z1 + (static_cast<unsigned long long>(z2) << 32);
+    }
+    X = x; Y = y; Z1 = z1; Z2 = z2; C1 = c1; C2 = c2;
+}
+
+void JLKiss64RandEngine::Discard(unsigned long long n)
 {
-    X = 1490024343005336237ULL * X + 123456789;
-    Y ^= Y << 21;
-    Y ^= Y >> 17;
-    Y ^= Y << 30;
+    auto [mult, inc] = lcgJump(1490024343005336237ULL, 123456789, n);
+    X = mult * X + inc;
+    Y = xorshiftJump<unsigned long long>(Y, n, [] (unsigned long long y) {
+        y ^= y << 21;
+        y ^= y >> 17;
+        y ^= y << 30;
+        return y;
+    });
+    mwcJump(4294584393ULL, Z1, C1, n);
+    mwcJump(4246477509ULL, Z2, C2, n);
+}
 
-    unsigned long long t = 4294584393ULL * Z1 + C1;
-    C1 = t >> 32;
-    Z1 = t;
-    t = 4246477509ULL * Z2 + C2;
-    C2 = t >> 32;
-    Z2 = t;
-    return X + Y + Z1 + (static_cast<unsigned long long>(Z2) << 32);
+JLKiss64RandEngine JLKiss64RandEngine::Split()
+{
+    JLKiss64RandEngine child(*this);
+    Discard(SPLIT_DISTANCE);
+    return child;
 }
 
 void PCGRandEngine::Reseed(unsigned long seed)
@@ -83,11 +241,30 @@ void PCGRandEngine::Reseed(unsigned long seed)
     inc = seed;
 }
 
-unsigned long long PCGRandEngine::Next()
+void PCGRandEngine::Fill(unsigned long long *output, size_t n)
+{
+    /// keep the state in registers for the whole block
+    unsigned long long s = state;
+    const unsigned long long increment = inc | 1;
+    for (size_t i = 0; i != n; ++i) {
+        unsigned long long oldstate = s;
+        s = oldstate * 6364136223846793005ULL + increment;
+        unsigned int xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
+        unsigned int rot = oldstate >> 59u;
+        output[i] = (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    }
+    state = s;
+}
+
+void PCGRandEngine::Discard(unsigned long long n)
+{
+    auto [mult, increment] = lcgJump(6364136223846793005ULL, inc | 1, n);
+    state = mult * state + increment;
+}
+
+PCGRandEngine PCGRandEngine::Split()
 {
-    unsigned long long oldstate = state;
-    state = oldstate * 6364136223846793005ULL + (inc|1);
-    unsigned int xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
-    unsigned int rot = oldstate >> 59u;
-    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    PCGRandEngine child(*this);
+    Discard(SPLIT_DISTANCE);
+    return child;
 }
@@ -7,6 +7,9 @@
 
 /**
  * @brief The RandEngine class
+ * Common base of all engines. It is not polymorphic: engines are
+ * final value types and BasicRandGenerator calls them statically,
+ * so that Next() can be inlined into the samplers
  */
 class RANDLIBSHARED_EXPORT RandEngine
 {
@@ -26,19 +29,14 @@ protected:
      */
     static unsigned long getRandomSeed();
 
-public:
     RandEngine() {}
-    virtual ~RandEngine() {}
-    virtual unsigned long long MinValue() const = 0;
-    virtual unsigned long long MaxValue() const = 0;
-    virtual void Reseed(unsigned long seed) = 0;
-    virtual unsigned long long Next() = 0;
+    ~RandEngine() {}
 };
 
 /**
  * @brief The JKissRandEngine class
  */
-class RANDLIBSHARED_EXPORT JKissRandEngine : public RandEngine
+class RANDLIBSHARED_EXPORT JKissRandEngine final : public RandEngine
 {
     unsigned int X{};
     unsigned int C{};
@@ -46,17 +44,53 @@ class RANDLIBSHARED_EXPORT JKissRandEngine : public RandEngine
     unsigned int Z{};
 
 public:
+    static constexpr unsigned long long SPLIT_DISTANCE = 1ULL << 63; ///< combined period exceeds 2^120
     JKissRandEngine() { this->Reseed(getRandomSeed()); }
-    unsigned long long MinValue() const { return 0; }
-    unsigned long long MaxValue() const { return 4294967295UL; }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 4294967295UL; }
     void Reseed(unsigned long seed);
-    unsigned long long Next();
+    /**
+     * @fn Fill
+     * @param output pointer on the first of n raw words to generate
+     * @param n
+     */
+    void Fill(unsigned long long *output, size_t n);
+    /**
+     * @fn Discard
+     * advance the engine by n steps in O(log n)
+     * @param n
+     */
+    void Discard(unsigned long long n);
+    /**
+     * @fn Split
+     * @return engine, which generates next SPLIT_DISTANCE words of this stream,
+     * while this engine jumps over them. Hence children never overlap
+     * with each other or with the parent as long as each of them
+     * generates less than SPLIT_DISTANCE words
+     */
+    JKissRandEngine Split();
+    inline unsigned long long Next()
+    {
+        unsigned long long t = 698769069ULL * Z + C;
+
+        X *= 69069;
+        X += 12345;
+
+        Y ^= Y << 13;
+        Y ^= Y >> 17;
+        Y ^= Y << 5;
+
+        C = t >> 32;
+        Z = t;
+
+        return X + Y + Z;
+    }
 };
 
 /**
  * @brief The JLKiss64RandEngine class
  */
-class RANDLIBSHARED_EXPORT JLKiss64RandEngine : public RandEngine
+class RANDLIBSHARED_EXPORT JLKiss64RandEngine final : public RandEngine
 {
     unsigned long long X{};
     unsigned long long Y{};
@@ -66,28 +100,91 @@ class RANDLIBSHARED_EXPORT JLKiss64RandEngine : public RandEngine
     unsigned int C2{};
 
 public:
+    static constexpr unsigned long long SPLIT_DISTANCE = 1ULL << 63; ///< combined period exceeds 2^250
     JLKiss64RandEngine() { this->Reseed(getRandomSeed()); }
-    unsigned long long MinValue() const { return 0; }
-    unsigned long long MaxValue() const { return 18446744073709551615ULL; }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 18446744073709551615ULL; }
     void Reseed(unsigned long seed);
-    unsigned long long Next();
+    /**
+     * @fn Fill
+     * @param output pointer on the first of n raw words to generate
+     * @param n
+     */
+    void Fill(unsigned long long *output, size_t n);
+    /**
+     * @fn Discard
+     * advance the engine by n steps in O(log n)
+     * @param n
+     */
+    void Discard(unsigned long long n);
+    /**
+     * @fn Split
+     * @return engine, which generates next SPLIT_DISTANCE words of this stream,
+     * while this engine jumps over them. Hence children never overlap
+     * with each other or with the parent as long as each of them
+     * generates less than SPLIT_DISTANCE words
+     */
+    JLKiss64RandEngine Split();
+    inline unsigned long long Next()
+    {
+        X = 1490024343005336237ULL * X + 123456789;
+        Y ^= Y << 21;
+        Y ^= Y >> 17;
+        Y ^= Y << 30;
+
+        unsigned long long t = 4294584393ULL * Z1 + C1;
+        C1 = t >> 32;
+        Z1 = t;
+        t = 4246477509ULL * Z2 + C2;
+        C2 = t >> 32;
+        Z2 = t;
+        return X + Y + Z1 + (static_cast<unsigned long long>(Z2) << 32);
+    }
 };
 
 /**
  * @brief The PCGRandEngine class
  * Random number generator, taken from http://www.pcg-random.org/
  */
-class RANDLIBSHARED_EXPORT PCGRandEngine : public RandEngine
+class RANDLIBSHARED_EXPORT PCGRandEngine final : public RandEngine
 {
     unsigned long long state{};
     unsigned long long inc{};
 
 public:
+    static constexpr unsigned long long SPLIT_DISTANCE = 1ULL << 48; ///< period is 2^64, so up to 2^16 disjoint children
     PCGRandEngine() { this->Reseed(getRandomSeed()); }
-    unsigned long long MinValue() const { return 0; }
-    unsigned long long MaxValue() const { return 4294967295UL; }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 4294967295UL; }
     void Reseed(unsigned long seed);
-    unsigned long long Next();
+    /**
+     * @fn Fill
+     * @param output pointer on the first of n raw words to generate
+     * @param n
+     */
+    void Fill(unsigned long long *output, size_t n);
+    /**
+     * @fn Discard
+     * advance the engine by n steps in O(log n)
+     * @param n
+     */
+    void Discard(unsigned long long n);
+    /**
+     * @fn Split
+     * @return engine, which generates next SPLIT_DISTANCE words of this stream,
+     * while this engine jumps over them. Hence children never overlap
+     * with each other or with the parent as long as each of them
+     * generates less than SPLIT_DISTANCE words
+     */
+    PCGRandEngine Split();
+    inline unsigned long long Next()
+    {
+        unsigned long long oldstate = state;
+        state = oldstate * 6364136223846793005ULL + (inc|1);
+        unsigned int xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
+        unsigned int rot = oldstate >> 59u;
+        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    }
 };
 
 /**
@@ -117,13 +214,35 @@ class RANDLIBSHARED_EXPORT BasicRandGenerator
         return num;
     }
 
+    explicit BasicRandGenerator(const Engine &source) : engine(source) {}
+
 public:
     BasicRandGenerator() {}
 
-    unsigned long long Variate() { return engine.Next(); }
-    size_t maxDecimals() { return getDecimals(engine.MaxValue()); }
-    unsigned long long MaxValue() { return engine.MaxValue(); }
+    inline unsigned long long Variate() { return engine.Next(); }
+    static size_t maxDecimals() { return getDecimals(Engine::MaxValue()); }
+    static constexpr unsigned long long MaxValue() { return Engine::MaxValue(); }
     void Reseed(unsigned long seed) { engine.Reseed(seed); }
+    /**
+     * @fn Fill
+     * fills the buffer with n raw variates in one call,
+     * equivalent to n calls of Variate()
+     * @param output
+     * @param n
+     */
+    void Fill(unsigned long long *output, size_t n) { engine.Fill(output, n); }
+    /**
+     * @fn Discard
+     * skip n variates
+     * @param n
+     */
+    void Discard(unsigned long long n) { engine.Discard(n); }
+    /**
+     * @fn Split
+     * @return generator with a stream, disjoint from the rest of this one
+     * (see Engine::Split)
+     */
+    BasicRandGenerator Split() { return BasicRandGenerator(engine.Split()); }
 };
 
 #ifdef JLKISS64RAND
@@ -0,0 +1,80 @@
+#include "CounterRandEngine.h"
+
+void PhiloxRandEngine::Reseed(unsigned long seed)
+{
+    unsigned long long s = seed;
+    key[0] = s;
+    key[1] = s >> 32;
+    counter = 0;
+    position = 4;
+}
+
+void PhiloxRandEngine::Block(const unsigned int key[2], const unsigned int counter[4], unsigned int output[4])
+{
+    static constexpr unsigned long long M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    static constexpr unsigned int W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+    unsigned int c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    unsigned int k0 = key[0], k1 = key[1];
+    for (int round = 0; round != 10; ++round) {
+        unsigned long long p0 = M0 * c0, p1 = M1 * c2;
+        unsigned int hi0 = p0 >> 32, lo0 = p0;
+        unsigned int hi1 = p1 >> 32, lo1 = p1;
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+        k0 += W0;
+        k1 += W1;
+    }
+    output[0] = c0;
+    output[1] = c1;
+    output[2] = c2;
+    output[3] = c3;
+}
+
+void PhiloxRandEngine::generateBlock(unsigned long long blockIndex, unsigned int *output) const
+{
+    unsigned int ctr[4] = {static_cast<unsigned int>(blockIndex), static_cast<unsigned int>(blockIndex >> 32), 0, 0};
+    Block(key, ctr, output);
+}
+
+void ThreefryRandEngine::Reseed(unsigned long seed)
+{
+    key[0] = seed;
+    key[1] = 0;
+    counter = 0;
+    position = 4;
+}
+
+void ThreefryRandEngine::Block(const unsigned long long key[2], const unsigned long long counter[2], unsigned long long output[2])
+{
+    static constexpr unsigned int R[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    const unsigned long long ks[3] = {key[0], key[1], 0x1BD11BDAA9FC1A22ULL ^ key[0] ^ key[1]};
+    unsigned long long x0 = counter[0] + ks[0];
+    unsigned long long x1 = counter[1] + ks[1];
+    for (int round = 0; round != 20; ++round) {
+        unsigned int r = R[round & 7];
+        x0 += x1;
+        x1 = (x1 << r) | (x1 >> (64 - r));
+        x1 ^= x0;
+        /// key injection after every 4 rounds
+        if ((round & 3) == 3) {
+            int s = (round >> 2) + 1;
+            x0 += ks[s % 3];
+            x1 += ks[(s + 1) % 3] + s;
+        }
+    }
+    output[0] = x0;
+    output[1] = x1;
+}
+
+void ThreefryRandEngine::generateBlock(unsigned long long blockIndex, unsigned int *output) const
+{
+    const unsigned long long ctr[2] = {blockIndex, 0};
+    unsigned long long words[2];
+    Block(key, ctr, words);
+    output[0] = words[0];
+    output[1] = words[0] >> 32;
+    output[2] = words[1];
+    output[3] = words[1] >> 32;
+}
@@ -0,0 +1,163 @@
+#ifndef COUNTERRANDENGINE_H
+#define COUNTERRANDENGINE_H
+
+#include "BasicRandGenerator.h"
+
+/**
+ * @brief The CounterRandEngine class
+ * Common part of counter-based engines: i-th block of four 32-bit words
+ * is a bijection of counter i under the key, derived from seed.
+ * Hence any position of the stream can be reached in O(1) by Seek,
+ * and copies of one engine, moved to disjoint positions, produce
+ * the same words as a single engine would in sequence.
+ * @tparam Derived engine that implements
+ * void generateBlock(unsigned long long blockIndex, unsigned int *output) const
+ */
+template < class Derived >
+class RANDLIBSHARED_EXPORT CounterRandEngine : public RandEngine
+{
+protected:
+    unsigned long long counter = 0; ///< index of the next block
+    unsigned int buffer[4]{};
+    unsigned int position = 4; ///< index of the next word in the buffer
+
+    CounterRandEngine() {}
+    ~CounterRandEngine() {}
+
+    inline void nextBlock(unsigned int *output)
+    {
+        static_cast<Derived *>(this)->generateBlock(counter++, output);
+    }
+
+public:
+    static constexpr unsigned long long SPLIT_DISTANCE = 1ULL << 60;
+
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 4294967295UL; }
+
+    inline unsigned long long Next()
+    {
+        if (position == 4) {
+            nextBlock(buffer);
+            position = 0;
+        }
+        return buffer[position++];
+    }
+
+    /**
+     * @fn Fill
+     * @param output pointer on the first of n raw words to generate
+     * @param n
+     */
+    void Fill(unsigned long long *output, size_t n)
+    {
+        size_t i = 0;
+        while (i != n && position != 4)
+            output[i++] = buffer[position++];
+        unsigned int block[4];
+        for (; i + 4 <= n; i += 4) {
+            nextBlock(block);
+            output[i] = block[0];
+            output[i + 1] = block[1];
+            output[i + 2] = block[2];
+            output[i + 3] = block[3];
+        }
+        while (i != n)
+            output[i++] = Next();
+    }
+
+    /**
+     * @fn Tell
+     * @return amount of words generated since reseeding
+     */
+    unsigned long long Tell() const { return 4 * counter - (4 - position); }
+
+    /**
+     * @fn Seek
+     * jump to given position of the stream in O(1)
+     * @param wordIndex
+     */
+    void Seek(unsigned long long wordIndex)
+    {
+        counter = wordIndex >> 2;
+        position = 4;
+        unsigned int offset = wordIndex & 3;
+        if (offset != 0) {
+            nextBlock(buffer);
+            position = offset;
+        }
+    }
+
+    /**
+     * @fn Discard
+     * skip n words in O(1)
+     * @param n
+     */
+    void Discard(unsigned long long n) { Seek(Tell() + n); }
+
+    /**
+     * @fn Split
+     * @return engine, which generates next SPLIT_DISTANCE words of this stream,
+     * while this engine jumps over them
+     */
+    Derived Split()
+    {
+        Derived child(*static_cast<Derived *>(this));
+        Discard(SPLIT_DISTANCE);
+        return child;
+    }
+};
+
+/**
+ * @brief The PhiloxRandEngine class
+ * Philox4x32-10 counter-based generator
+ * (Salmon, Moraes, Dror, Shaw, "Parallel random numbers: as easy as 1, 2, 3", 2011)
+ */
+class RANDLIBSHARED_EXPORT PhiloxRandEngine final : public CounterRandEngine<PhiloxRandEngine>
+{
+    unsigned int key[2]{};
+
+    void generateBlock(unsigned long long blockIndex, unsigned int *output) const;
+
+    friend class CounterRandEngine<PhiloxRandEngine>;
+
+public:
+    PhiloxRandEngine() { this->Reseed(getRandomSeed()); }
+    void Reseed(unsigned long seed);
+
+    /**
+     * @fn Block
+     * @param key
+     * @param counter 128-bit counter
+     * @param output four words of Philox4x32-10(key, counter)
+     */
+    static void Block(const unsigned int key[2], const unsigned int counter[4], unsigned int output[4]);
+};
+
+/**
+ * @brief The ThreefryRandEngine class
+ * Threefry2x64-20 counter-based generator
+ * (Salmon, Moraes, Dror, Shaw, "Parallel random numbers: as easy as 1, 2, 3", 2011)
+ */
+class RANDLIBSHARED_EXPORT ThreefryRandEngine final : public CounterRandEngine<ThreefryRandEngine>
+{
+    unsigned long long key[2]{};
+
+    void generateBlock(unsigned long long blockIndex, unsigned int *output) const;
+
+    friend class CounterRandEngine<ThreefryRandEngine>;
+
+public:
+    ThreefryRandEngine() { this->Reseed(getRandomSeed()); }
+    void Reseed(unsigned long seed);
+
+    /**
+     * @fn Block
+     * @param key
+     * @param counter 128-bit counter
+     * @param output two words of Threefry2x64-20(key, counter)
+     */
+    static void Block(const unsigned long long key[2], const unsigned long long counter[2], unsigned long long output[2]);
+};
+
+#endif // COUNTERRANDENGINE_H
@@ -0,0 +1,206 @@
+#include "MultiStreamRandEngine.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RANDLIB_MULTISTREAM_DISPATCH
+#endif
+
+namespace
+{
+
+/**
+ * @fn splitMix64
+ * @param x state of SplitMix64 generator
+ * @return next value of SplitMix64, used for seeding of the streams
+ */
+unsigned long long splitMix64(unsigned long long &x)
+{
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+template < size_t LANES >
+inline void xoshiroKernel(unsigned int (&S)[4][LANES], unsigned long long *output, size_t blocks)
+{
+    unsigned int s0[LANES], s1[LANES], s2[LANES], s3[LANES];
+    for (size_t j = 0; j != LANES; ++j) {
+        s0[j] = S[0][j]; s1[j] = S[1][j]; s2[j] = S[2][j]; s3[j] = S[3][j];
+    }
+    for (size_t i = 0; i != blocks; ++i) {
+        unsigned long long *block = output + i * LANES;
+        for (size_t j = 0; j != LANES; ++j) {
+            unsigned int x = s1[j] * 5;
+            block[j] = ((x << 7) | (x >> 25)) * 9;
+            unsigned int t = s1[j] << 9;
+            s2[j] ^= s0[j];
+            s3[j] ^= s1[j];
+            s1[j] ^= s2[j];
+            s0[j] ^= s3[j];
+            s2[j] ^= t;
+            s3[j] = (s3[j] << 11) | (s3[j] >> 21);
+        }
+    }
+    for (size_t j = 0; j != LANES; ++j) {
+        S[0][j] = s0[j]; S[1][j] = s1[j]; S[2][j] = s2[j]; S[3][j] = s3[j];
+    }
+}
+
+template < size_t LANES >
+inline void pcgKernel(unsigned long long (&state)[LANES], const unsigned long long (&inc)[LANES], unsigned long long *output, size_t blocks)
+{
+    unsigned long long s[LANES];
+    for (size_t j = 0; j != LANES; ++j)
+        s[j] = state[j];
+    for (size_t i = 0; i != blocks; ++i) {
+        unsigned long long *block = output + i * LANES;
+        for (size_t j = 0; j != LANES; ++j) {
+            unsigned long long oldstate = s[j];
+            s[j] = oldstate * 6364136223846793005ULL + inc[j];
+            unsigned int xorshifted = ((oldstate >> 18u) ^ oldstate) >> 27u;
+            unsigned int rot = oldstate >> 59u;
+            block[j] = (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+        }
+    }
+    for (size_t j = 0; j != LANES; ++j)
+        state[j] = s[j];
+}
+
+template < size_t LANES >
+using XoshiroKernelPtr = void (*)(unsigned int (&)[4][LANES], unsigned long long *, size_t);
+
+template < size_t LANES >
+using PCGKernelPtr = void (*)(unsigned long long (&)[LANES], const unsigned long long (&)[LANES], unsigned long long *, size_t);
+
+#ifdef RANDLIB_MULTISTREAM_DISPATCH
+/// The same kernels, compiled for wider vector units.
+/// Integer arithmetic is exact, so every version gives the same bits
+template < size_t LANES >
+__attribute__((target("avx2"))) void xoshiroKernelAVX2(unsigned int (&S)[4][LANES], unsigned long long *output, size_t blocks)
+{
+    xoshiroKernel<LANES>(S, output, blocks);
+}
+
+template < size_t LANES >
+__attribute__((target("avx512f"))) void xoshiroKernelAVX512(unsigned int (&S)[4][LANES], unsigned long long *output, size_t blocks)
+{
+    xoshiroKernel<LANES>(S, output, blocks);
+}
+
+template < size_t LANES >
+__attribute__((target("avx2"))) void pcgKernelAVX2(unsigned long long (&state)[LANES], const unsigned long long (&inc)[LANES], unsigned long long *output, size_t blocks)
+{
+    pcgKernel<LANES>(state, inc, output, blocks);
+}
+
+template < size_t LANES >
+__attribute__((target("avx512f,avx512dq"))) void pcgKernelAVX512(unsigned long long (&state)[LANES], const unsigned long long (&inc)[LANES], unsigned long long *output, size_t blocks)
+{
+    pcgKernel<LANES>(state, inc, output, blocks);
+}
+#endif
+
+template < size_t LANES >
+XoshiroKernelPtr<LANES> chooseXoshiroKernel()
+{
+#ifdef RANDLIB_MULTISTREAM_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return xoshiroKernelAVX512<LANES>;
+    if (__builtin_cpu_supports("avx2"))
+        return xoshiroKernelAVX2<LANES>;
+#endif
+    return xoshiroKernel<LANES>;
+}
+
+template < size_t LANES >
+PCGKernelPtr<LANES> choosePCGKernel()
+{
+#ifdef RANDLIB_MULTISTREAM_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+        return pcgKernelAVX512<LANES>;
+    if (__builtin_cpu_supports("avx2"))
+        return pcgKernelAVX2<LANES>;
+#endif
+    return pcgKernel<LANES>;
+}
+
+}
+
+template < size_t LANES >
+void XoshiroMultiRandEngine<LANES>::generateBlocks(unsigned long long *output, size_t blocks)
+{
+    static const XoshiroKernelPtr<LANES> kernel = chooseXoshiroKernel<LANES>();
+    kernel(S, output, blocks);
+}
+
+template < size_t LANES >
+void XoshiroMultiRandEngine<LANES>::Reseed(unsigned long seed)
+{
+    unsigned long long x = seed;
+    for (size_t j = 0; j != LANES; ++j) {
+        unsigned long long a = splitMix64(x), b = splitMix64(x);
+        S[0][j] = a;
+        S[1][j] = a >> 32;
+        S[2][j] = b;
+        S[3][j] = b >> 32;
+        /// all-zero state is the only forbidden one
+        if ((a | b) == 0)
+            S[0][j] = 1;
+    }
+    position = LANES;
+}
+
+template < size_t LANES >
+void XoshiroMultiRandEngine<LANES>::Fill(unsigned long long *output, size_t n)
+{
+    size_t i = 0;
+    while (i != n && position != LANES)
+        output[i++] = buffer[position++];
+    size_t blocks = (n - i) / LANES;
+    generateBlocks(output + i, blocks);
+    i += blocks * LANES;
+    while (i != n)
+        output[i++] = Next();
+}
+
+template < size_t LANES >
+void PCGMultiRandEngine<LANES>::generateBlocks(unsigned long long *output, size_t blocks)
+{
+    static const PCGKernelPtr<LANES> kernel = choosePCGKernel<LANES>();
+    kernel(state, inc, output, blocks);
+}
+
+template < size_t LANES >
+void PCGMultiRandEngine<LANES>::Reseed(unsigned long seed)
+{
+    unsigned long long x = seed;
+    for (size_t j = 0; j != LANES; ++j) {
+        state[j] = splitMix64(x);
+        /// odd increments, drawn independently, select different streams
+        inc[j] = (splitMix64(x) << 1) | 1;
+    }
+    position = LANES;
+}
+
+template < size_t LANES >
+void PCGMultiRandEngine<LANES>::Fill(unsigned long long *output, size_t n)
+{
+    size_t i = 0;
+    while (i != n && position != LANES)
+        output[i++] = buffer[position++];
+    size_t blocks = (n - i) / LANES;
+    generateBlocks(output + i, blocks);
+    i += blocks * LANES;
+    while (i != n)
+        output[i++] = Next();
+}
+
+template class XoshiroMultiRandEngine<4>;
+template class XoshiroMultiRandEngine<8>;
+template class XoshiroMultiRandEngine<16>;
+
+template class PCGMultiRandEngine<4>;
+template class PCGMultiRandEngine<8>;
+template class PCGMultiRandEngine<16>;
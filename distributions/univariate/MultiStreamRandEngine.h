@@ -0,0 +1,102 @@
+#ifndef MULTISTREAMRANDENGINE_H
+#define MULTISTREAMRANDENGINE_H
+
+#include "BasicRandGenerator.h"
+
+/**
+ * @brief The XoshiroMultiRandEngine class
+ * LANES independent xoshiro128** streams, advanced together
+ * in structure-of-arrays layout, so that one step of all streams
+ * maps onto SIMD registers (SSE2 / AVX2 / AVX-512, chosen at runtime).
+ * Output is interleaved: k-th block of LANES values contains
+ * k-th output of every stream, in lane order. Only integer arithmetic
+ * is used, so the sequence is bit-identical for any instruction set.
+ */
+template < size_t LANES >
+class RANDLIBSHARED_EXPORT XoshiroMultiRandEngine final : public RandEngine
+{
+    static_assert(LANES == 4 || LANES == 8 || LANES == 16, "Number of lanes should be 4, 8 or 16");
+
+    alignas(64) unsigned int S[4][LANES]{};
+    alignas(64) unsigned long long buffer[LANES]{};
+    size_t position = LANES;
+
+    /**
+     * @fn generateBlocks
+     * advances all streams by given amount of steps
+     * @param output pointer on blocks * LANES values
+     * @param blocks
+     */
+    void generateBlocks(unsigned long long *output, size_t blocks);
+
+public:
+    XoshiroMultiRandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 4294967295UL; }
+    void Reseed(unsigned long seed);
+    /**
+     * @fn Fill
+     * @param output pointer on the first of n raw words to generate
+     * @param n
+     */
+    void Fill(unsigned long long *output, size_t n);
+    inline unsigned long long Next()
+    {
+        if (position == LANES) {
+            generateBlocks(buffer, 1);
+            position = 0;
+        }
+        return buffer[position++];
+    }
+};
+
+/**
+ * @brief The PCGMultiRandEngine class
+ * LANES independent PCG32 (XSH-RR) streams with distinct increments,
+ * advanced together in structure-of-arrays layout.
+ * Output is interleaved the same way as in XoshiroMultiRandEngine
+ * and does not depend on instruction set.
+ */
+template < size_t LANES >
+class RANDLIBSHARED_EXPORT PCGMultiRandEngine final : public RandEngine
+{
+    static_assert(LANES == 4 || LANES == 8 || LANES == 16, "Number of lanes should be 4, 8 or 16");
+
+    alignas(64) unsigned long long state[LANES]{};
+    alignas(64) unsigned long long inc[LANES]{};
+    alignas(64) unsigned long long buffer[LANES]{};
+    size_t position = LANES;
+
+    /**
+     * @fn generateBlocks
+     * advances all streams by given amount of steps
+     * @param output pointer on blocks * LANES values
+     * @param blocks
+     */
+    void generateBlocks(unsigned long long *output, size_t blocks);
+
+public:
+    PCGMultiRandEngine() { this->Reseed(getRandomSeed()); }
+    static constexpr unsigned long long MinValue() { return 0; }
+    static constexpr unsigned long long MaxValue() { return 4294967295UL; }
+    void Reseed(unsigned long seed);
+    /**
+     * @fn Fill
+     * @param output pointer on the first of n raw words to generate
+     * @param n
+     */
+    void Fill(unsigned long long *output, size_t n);
+    inline unsigned long long Next()
+    {
+        if (position == LANES) {
+            generateBlocks(buffer, 1);
+            position = 0;
+        }
+        return buffer[position++];
+    }
+};
+
+typedef BasicRandGenerator<XoshiroMultiRandEngine<8>> XoshiroMultiRandGenerator;
+typedef BasicRandGenerator<PCGMultiRandEngine<8>> PCGMultiRandGenerator;
+
+#endif // MULTISTREAMRANDENGINE_H
@@ -1,5 +1,7 @@
 #include "UnivariateDistribution.h"
 
+#include <numeric>
+
 template< typename T >
 UnivariateDistribution<T>::UnivariateDistribution()
 {
@@ -53,20 +55,75 @@ T UnivariateDistribution<T>::Quantile1m(double p) const
     return (x > maxVal) ? maxVal : x;
 }
 
+template< typename T >
+void UnivariateDistribution<T>::quantileSorted(const std::vector<double> &p, std::vector<T> &y, const size_t *order, size_t size, bool isComplement) const
+{
+    double minVal = this->MinValue(), maxVal = this->MaxValue();
+    bool hasInitValue = false;
+    T initValue = 0;
+    for (size_t i = 0; i != size; ++i) {
+        size_t j = order[i];
+        double prob = p[j];
+        if (hasInitValue && prob > 0.0 && prob < 1.0) {
+            double x = isComplement ? this->quantileImpl1m(prob, initValue) : this->quantileImpl(prob, initValue);
+            y[j] = (x < minVal) ? minVal : ((x > maxVal) ? maxVal : x);
+        }
+        else
+            y[j] = isComplement ? this->Quantile1m(prob) : this->Quantile(prob);
+        /// solution on the boundary of support is not a valid starting point
+        initValue = y[j];
+        hasInitValue = (initValue > minVal && initValue < maxVal);
+    }
+}
+
+template< typename T >
+void UnivariateDistribution<T>::quantileFunctionImpl(const std::vector<double> &p, std::vector<T> &y, bool isComplement) const
+{
+    size_t size = std::min(p.size(), y.size());
+    if (!this->canWarmStartQuantile()) {
+        for (size_t i = 0; i != size; ++i)
+            y[i] = isComplement ? this->Quantile1m(p[i]) : this->Quantile(p[i]);
+        return;
+    }
+
+    for (size_t i = 0; i != size; ++i) {
+        if (!(p[i] >= 0.0 && p[i] <= 1.0))
+            throw std::invalid_argument("Probability p in quantile function should be in interval [0, 1]");
+    }
+    std::vector<size_t> order(size);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&p] (size_t i, size_t j)
+    {
+        return p[i] < p[j];
+    });
+
+    /// split sorted probabilities into chunks, which are solved concurrently
+    static constexpr size_t MIN_CHUNK_SIZE = 1024;
+    Executor &executor = Executor::Default();
+    size_t chunksNum = std::min(executor.ThreadsNum(), size / MIN_CHUNK_SIZE);
+    if (chunksNum <= 1) {
+        this->quantileSorted(p, y, order.data(), size, isComplement);
+        return;
+    }
+    size_t chunkSize = (size + chunksNum - 1) / chunksNum;
+    executor.ParallelFor(chunksNum, [this, &p, &y, &order, chunkSize, size, isComplement] (size_t chunk)
+    {
+        size_t start = chunk * chunkSize;
+        if (start < size)
+            this->quantileSorted(p, y, order.data() + start, std::min(chunkSize, size - start), isComplement);
+    });
+}
+
 template< typename T >
 void UnivariateDistribution<T>::QuantileFunction(const std::vector<double> &p, std::vector<T> &y)
 {
-    int size = std::min(p.size(), y.size());
-    for (int i = 0; i != size; ++i)
-        y[i] = this->Quantile(p[i]);
+    this->quantileFunctionImpl(p, y, false);
 }
 
 template< typename T >
 void UnivariateDistribution<T>::QuantileFunction1m(const std::vector<double> &p, std::vector<T> &y)
 {
-    int size = std::min(p.size(), y.size());
-    for (int i = 0; i != size; ++i)
-        y[i] = this->Quantile1m(p[i]);
+    this->quantileFunctionImpl(p, y, true);
 }
 
 template< typename T >
@@ -71,6 +71,35 @@ private:
     virtual T quantileImpl1m(double p, T initValue) const = 0;
     virtual T quantileImpl1m(double p) const = 0;
 
+    /**
+     * @fn canWarmStartQuantile
+     * @return true if quantileImpl(p) is a numerical procedure,
+     * which can be replaced by quantileImpl(p, initValue)
+     * with any initial value close to the solution
+     */
+    virtual bool canWarmStartQuantile() const { return false; }
+
+    /**
+     * @fn quantileSorted
+     * fills y[order[i]] with quantiles of p[order[i]] for i = 0, ..., size - 1,
+     * where p[order[i]] are ascending, so that each numerical procedure
+     * starts from the previous solution
+     * @param p
+     * @param y
+     * @param order
+     * @param size
+     * @param isComplement if true, quantiles of 1 - p are computed
+     */
+    void quantileSorted(const std::vector<double> &p, std::vector<T> &y, const size_t *order, size_t size, bool isComplement) const;
+
+    /**
+     * @fn quantileFunctionImpl
+     * @param p
+     * @param y
+     * @param isComplement
+     */
+    void quantileFunctionImpl(const std::vector<double> &p, std::vector<T> &y, bool isComplement) const;
+
 protected:
     /**
      * @fn CFimpl
@@ -104,6 +133,9 @@ public:
 
     /**
      * @fn QuantileFunction
+     * If quantile is computed numerically, probabilities are processed
+     * in ascending order, each root search starts from the neighbouring solution,
+     * and large inputs are split into chunks, solved concurrently
      * @param p
      * @param y
      * @return fills vector y with Quantile(p)
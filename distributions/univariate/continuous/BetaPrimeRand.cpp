@@ -92,6 +92,12 @@ void BetaPrimeRand<RealType>::Reseed(unsigned long seed) const
     B.Reseed(seed);
 }
 
+template < typename RealType >
+void BetaPrimeRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    B.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double BetaPrimeRand<RealType>::Mean() const
 {
@@ -131,6 +131,117 @@ double BetaDistribution<RealType>::S(const RealType &x) const
     return RandMath::ibeta(1.0 - xSt, beta, alpha, logBetaFun, std::log1pl(-xSt), std::log(xSt));
 }
 
+template < typename RealType >
+void BetaDistribution<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double lower = a, upper = b;
+    const double atLower = (alpha == 1) ? beta / bma : ((alpha > 1) ? 0.0 : INFINITY);
+    const double atUpper = (beta == 1) ? alpha / bma : ((beta > 1) ? 0.0 : INFINITY);
+    logpdfBatch(x, y, n);
+    RandMath::vexp(y, y, n);
+    /// support is checked on x itself as in f, since standardization can round x onto the bounds
+    for (size_t i = 0; i != n; ++i) {
+        if (x[i] < lower || x[i] > upper)
+            y[i] = 0.0;
+        else if (x[i] == lower)
+            y[i] = atLower;
+        else if (x[i] == upper)
+            y[i] = atUpper;
+    }
+}
+
+template < typename RealType >
+void BetaDistribution<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape1m1 = alpha - 1, shape2m1 = beta - 1, lower = a, rangeInv = bmaInv;
+    const double coef = logBetaFun + logbma;
+    const double atLower = (alpha == 1) ? std::log(beta / bma) : ((alpha > 1) ? -INFINITY : INFINITY);
+    const double atUpper = (beta == 1) ? std::log(alpha / bma) : ((beta > 1) ? -INFINITY : INFINITY);
+    double logX[RandMath::VECTOR_MATH_BUFFER_SIZE], log1mX[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i) {
+            double xSt = (x[start + i] - lower) * rangeInv;
+            logX[i] = (xSt > 0.0 && xSt < 1.0) ? xSt : 0.5;
+            log1mX[i] = -logX[i];
+        }
+        RandMath::vlog(logX, logX, size);
+        RandMath::vlog1p(log1mX, log1mX, size);
+        for (size_t i = 0; i != size; ++i) {
+            double xSt = (x[start + i] - lower) * rangeInv;
+            if (xSt > 0.0 && xSt < 1.0) {
+                double z = shape1m1 * logX[i];
+                z += shape2m1 * log1mX[i];
+                y[start + i] = z - coef;
+            }
+            else if (xSt < 0.0 || xSt > 1.0)
+                y[start + i] = -INFINITY;
+            else if (xSt == 0.0)
+                y[start + i] = atLower;
+            else /// upper bound or NaN, which is propagated as in logf
+                y[start + i] = (xSt == 1.0) ? atUpper : xSt;
+        }
+    }
+}
+
+template < typename RealType >
+void BetaDistribution<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape1 = alpha, shape2 = beta, lower = a, upper = b, rangeInv = bmaInv, logBeta = logBetaFun;
+    /// Workaround known case
+    if (shape1 == shape2 && shape2 == 0.5) {
+        for (size_t i = 0; i != n; ++i) {
+            if (x[i] <= lower)
+                y[i] = 0.0;
+            else
+                y[i] = (x[i] >= upper) ? 1.0 : M_2_PI * std::asin(std::sqrt((x[i] - lower) * rangeInv));
+        }
+        return;
+    }
+    double xSt[RandMath::VECTOR_MATH_BUFFER_SIZE], logX[RandMath::VECTOR_MATH_BUFFER_SIZE], log1mX[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i) {
+            const RealType xi = x[start + i];
+            xSt[i] = (xi <= lower) ? 0.0 : ((xi >= upper) ? 1.0 : (xi - lower) * rangeInv);
+            log1mX[i] = -xSt[i];
+        }
+        RandMath::vlog(xSt, logX, size);
+        RandMath::vlog1p(log1mX, log1mX, size);
+        RandMath::ibeta(xSt, shape1, shape2, logBeta, logX, log1mX, y + start, size);
+    }
+}
+
+template < typename RealType >
+void BetaDistribution<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape1 = alpha, shape2 = beta, lower = a, upper = b, range = bma, logBeta = logBetaFun;
+    if (shape1 == shape2 && shape2 == 0.5) {
+        for (size_t i = 0; i != n; ++i) {
+            if (x[i] <= lower)
+                y[i] = 1.0;
+            else
+                y[i] = (x[i] >= upper) ? 0.0 : M_2_PI * std::acos(std::sqrt((x[i] - lower) / range));
+        }
+        return;
+    }
+    /// complementary function is I(1 - x, β, α)
+    double xSt[RandMath::VECTOR_MATH_BUFFER_SIZE], logX[RandMath::VECTOR_MATH_BUFFER_SIZE], log1mX[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i) {
+            const RealType xi = x[start + i];
+            xSt[i] = (xi <= lower) ? 0.0 : ((xi >= upper) ? 1.0 : (xi - lower) / range);
+            logX[i] = -xSt[i];
+        }
+        RandMath::vlog(xSt, log1mX, size);
+        RandMath::vlog1p(logX, logX, size);
+        for (size_t i = 0; i != size; ++i)
+            xSt[i] = 1.0 - xSt[i];
+        RandMath::ibeta(xSt, shape2, shape1, logBeta, logX, log1mX, y + start, size);
+    }
+}
+
 template < typename RealType >
 RealType BetaDistribution<RealType>::variateArcsine() const
 {
@@ -195,13 +306,13 @@ RealType BetaDistribution<RealType>::variateRejectionNormal() const
 }
 
 template < typename RealType >
-RealType BetaDistribution<RealType>::variateJohnk() const
+RealType BetaDistribution<RealType>::variateJohnk(double shape1, double shape2, RandGenerator &randGenerator)
 {
     RealType X = 0, Z = 0;
     RealType W = 0, V = 0;
     do {
-        W = ExponentialRand<RealType>::StandardVariate(this->localRandGenerator) / alpha;
-        V = ExponentialRand<RealType>::StandardVariate(this->localRandGenerator) / beta;
+        W = ExponentialRand<RealType>::StandardVariate(randGenerator) / shape1;
+        V = ExponentialRand<RealType>::StandardVariate(randGenerator) / shape2;
         X = std::exp(-W);
         Z = X + std::exp(-V);
     } while (Z > 1);
@@ -281,7 +392,7 @@ RealType BetaDistribution<RealType>::Variate() const
         var = variateRejectionNormal();
         break;
     case JOHNK:
-        var = variateJohnk();
+        var = variateJohnk(alpha, beta, this->localRandGenerator);
         break;
     case ATKINSON_WHITTAKER:
         var = variateAtkinsonWhittaker();
@@ -333,7 +444,7 @@ void BetaDistribution<RealType>::Sample(std::vector<RealType> &outputData) const
         break;
     case JOHNK: {
         for (RealType &var : outputData)
-            var = variateJohnk();
+            var = variateJohnk(alpha, beta, this->localRandGenerator);
         }
         break;
     case ATKINSON_WHITTAKER: {
@@ -355,6 +466,40 @@ void BetaDistribution<RealType>::Sample(std::vector<RealType> &outputData) const
         var = a + bma * var;
 }
 
+template < typename RealType >
+void BetaDistribution<RealType>::Variates(const std::vector<double> &shapes1, const std::vector<double> &shapes2, std::vector<RealType> &outputData, RandGenerator &randGenerator)
+{
+    size_t size = shapes1.size();
+    if (size != shapes2.size())
+        throw std::invalid_argument("Beta distribution: sizes of shapes should coincide");
+    for (size_t i = 0; i != size; ++i) {
+        if (!(shapes1[i] > 0.0 && shapes2[i] > 0.0))
+            throw std::invalid_argument("Beta distribution: shapes should be positive");
+    }
+    outputData.resize(size);
+
+    /// small shapes are sampled by Johnk's method, as both gamma variates can underflow,
+    /// the rest is collected for the gamma ratio
+    std::vector<size_t> indices;
+    std::vector<double> gammaShapes1, gammaShapes2;
+    for (size_t i = 0; i != size; ++i) {
+        double shape1 = shapes1[i], shape2 = shapes2[i];
+        if (shape1 + shape2 < 2 && std::min(shape1, shape2) < 1)
+            outputData[i] = variateJohnk(shape1, shape2, randGenerator);
+        else {
+            indices.push_back(i);
+            gammaShapes1.push_back(shape1);
+            gammaShapes2.push_back(shape2);
+        }
+    }
+
+    std::vector<RealType> X, Y;
+    GammaDistribution<RealType>::StandardVariates(gammaShapes1, X, randGenerator);
+    GammaDistribution<RealType>::StandardVariates(gammaShapes2, Y, randGenerator);
+    for (size_t j = 0; j != indices.size(); ++j)
+        outputData[indices[j]] = X[j] / (X[j] + Y[j]);
+}
+
 template < typename RealType >
 void BetaDistribution<RealType>::Reseed(unsigned long seed) const
 {
@@ -363,6 +508,14 @@ void BetaDistribution<RealType>::Reseed(unsigned long seed) const
     GammaRV2.Reseed(seed + 2);
 }
 
+template < typename RealType >
+void BetaDistribution<RealType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    GammaRV1.Discard(variatesNum);
+    GammaRV2.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double BetaDistribution<RealType>::Mean() const
 {
@@ -494,6 +647,38 @@ RealType BetaDistribution<RealType>::quantileImpl1m(double p) const
     return ContinuousDistribution<RealType>::quantileImpl1m(p);
 }
 
+template < typename RealType >
+bool BetaDistribution<RealType>::canWarmStartQuantile() const
+{
+    /// special cases of closed-form quantile
+    if (alpha == 1.0 || beta == 1.0)
+        return false;
+    return alpha != 0.5 || beta != 0.5;
+}
+
+template < typename RealType >
+long double BetaDistribution<RealType>::ExpectedValue(const std::function<double (RealType)> &funPtr, RealType minPoint, RealType maxPoint) const
+{
+    RealType lowerBoundary = std::max<RealType>(minPoint, a), upperBoundary = std::min<RealType>(maxPoint, b);
+    if (lowerBoundary >= upperBoundary)
+        return 0.0;
+    /// complement xc = lower - x or upper - x is the exact distance only to the bounds of support
+    const bool isLowerSupport = (lowerBoundary == a), isUpperSupport = (upperBoundary == b);
+    return RandMath::integral([this, &funPtr, isLowerSupport, isUpperSupport] (double x, double xc)
+    {
+        double y = funPtr(x);
+        if (y == 0.0)
+            return 0.0;
+        double xSt = (isLowerSupport && xc < 0) ? -xc * bmaInv : (x - a) * bmaInv;
+        double xStCompl = (isUpperSupport && xc > 0) ? xc * bmaInv : (b - x) * bmaInv;
+        if (xSt <= 0.0 || xStCompl <= 0.0)
+            return 0.0;
+        double logDensity = (alpha - 1) * std::log(xSt) + (beta - 1) * std::log(xStCompl);
+        return y * std::exp(logDensity - logBetaFun - logbma);
+    },
+    lowerBoundary, upperBoundary);
+}
+
 template < typename RealType >
 std::complex<double> BetaDistribution<RealType>::CFImpl(double t) const
 {
@@ -505,7 +690,10 @@ std::complex<double> BetaDistribution<RealType>::CFImpl(double t) const
     double sinZ = std::sin(z);
     double cosZm1 = std::cos(z) - 1.0;
 
-    double re = RandMath::integral([this, z, cosZm1](double x) {
+    /// integrands behave as powers of x and 1 - x at the boundaries,
+    /// tanh-sinh quadrature is not affected by such singularities
+    double error = 0.0;
+    double re = RandMath::doubleExponentialIntegral([this, z, cosZm1](double x) {
         if (x >= 1)
             return 0.0;
         if (x <= 0)
@@ -514,11 +702,11 @@ std::complex<double> BetaDistribution<RealType>::CFImpl(double t) const
         y *= std::pow(x, alpha - 1);
         y -= cosZm1;
         return std::pow(1.0 - x, beta - 1) * y;
-    }, 0, 1);
+    }, 0, 1, error);
     re += betaFun;
     re += cosZm1 / beta;
 
-    double im = RandMath::integral([this, z, sinZ](double x) {
+    double im = RandMath::doubleExponentialIntegral([this, z, sinZ](double x) {
         if (x >= 1)
             return 0.0;
         if (x <= 0)
@@ -527,7 +715,7 @@ std::complex<double> BetaDistribution<RealType>::CFImpl(double t) const
         y *= std::pow(x, alpha - 1);
         y -= sinZ;
         return std::pow(1.0 - x, beta - 1) * y;
-    }, 0, 1);
+    }, 0, 1, error);
     im += sinZ / beta;
 
     std::complex<double> y(re, im);
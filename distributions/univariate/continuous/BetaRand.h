@@ -166,9 +166,11 @@ private:
     /**
      * @fn variateJohnk
      * Johnk's beta generator
+     * @param shape1 α
+     * @param shape2 β
      * @return beta variate for small shape parameters < 1
      */
-    RealType variateJohnk() const;
+    static RealType variateJohnk(double shape1, double shape2, RandGenerator &randGenerator);
 
     /**
      * @fn variateCheng
@@ -194,7 +196,18 @@ private:
 public:
     RealType Variate() const override;
     void Sample(std::vector<RealType> &outputData) const override;
+    /**
+     * @fn Variates
+     * one variate on [0, 1] per pair of shapes: elements with α + β < 2 and min(α, β) < 1
+     * are sampled by Johnk's method, the rest as X / (X + Y), where X and Y are gamma variates
+     * generated by GammaDistribution::StandardVariates
+     * @param shapes1 α
+     * @param shapes2 β
+     * @param outputData beta variates with shapes α and β
+     */
+    static void Variates(const std::vector<double> &shapes1, const std::vector<double> &shapes2, std::vector<RealType> &outputData, RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     /**
@@ -221,8 +234,20 @@ public:
 protected:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override;
+
+    void pdfBatch(const RealType *x, double *y, size_t n) const override;
+    void logpdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfComplBatch(const RealType *x, double *y, size_t n) const override;
 
     std::complex<double> CFImpl(double t) const override;
+    /**
+     * @fn ExpectedValue
+     * density is evaluated from the distances to the bounds of support, which are passed
+     * by the quadrature exactly, so that singularities at a and b don't lose mass
+     */
+    long double ExpectedValue(const std::function<double (RealType)> &funPtr, RealType minPoint, RealType maxPoint) const override;
 
     static constexpr char ALPHA_ZERO[] = "Possibly one or more elements of the sample coincide with the lower boundary a.";
     static constexpr char BETA_ZERO[] = "Possibly one or more elements of the sample coincide with the upper boundary b.";
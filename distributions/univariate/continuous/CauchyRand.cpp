@@ -31,6 +31,51 @@ double CauchyRand<RealType>::S(const RealType & x) const
     return this->cdfCauchyCompl(x);
 }
 
+template < typename RealType >
+void CauchyRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = this->mu, scale = this->gamma;
+    for (size_t i = 0; i != n; ++i) {
+        double z = x[i] - location;
+        z *= z;
+        z /= scale;
+        y[i] = M_1_PI / (z + scale);
+    }
+}
+
+template < typename RealType >
+void CauchyRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = this->mu, scale = this->gamma, coef = this->pdfCoef;
+    for (size_t i = 0; i != n; ++i) {
+        double z = (x[i] - location) / scale;
+        y[i] = z * z;
+    }
+    RandMath::vlog1p(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = coef - y[i];
+}
+
+template < typename RealType >
+void CauchyRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = this->mu, scale = this->gamma;
+    for (size_t i = 0; i != n; ++i) {
+        double z = (x[i] - location) / scale;
+        y[i] = 0.5 + M_1_PI * RandMath::atan(z);
+    }
+}
+
+template < typename RealType >
+void CauchyRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = this->mu, scale = this->gamma;
+    for (size_t i = 0; i != n; ++i) {
+        double z = (location - x[i]) / scale;
+        y[i] = 0.5 + M_1_PI * RandMath::atan(z);
+    }
+}
+
 template < typename RealType >
 RealType CauchyRand<RealType>::Variate() const
 {
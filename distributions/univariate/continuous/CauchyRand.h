@@ -37,6 +37,12 @@ public:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
+
+    void pdfBatch(const RealType *x, double *y, size_t n) const override;
+    void logpdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfComplBatch(const RealType *x, double *y, size_t n) const override;
 
     std::complex<double> CFImpl(double t) const override;
 
@@ -4,17 +4,103 @@
 template< typename RealType >
 void ContinuousDistribution<RealType>::ProbabilityDensityFunction(const std::vector<RealType> &x, std::vector<double> &y) const
 {
-    for (size_t i = 0; i != x.size(); ++i)
-        y[i] = this->f(x[i]);
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    this->pdfBatch(x.data(), y.data(), size);
 }
 
 template< typename RealType >
 void ContinuousDistribution<RealType>::LogProbabilityDensityFunction(const std::vector<RealType> &x, std::vector<double> &y) const
 {
-    for (size_t i = 0; i != x.size(); ++i)
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    this->logpdfBatch(x.data(), y.data(), size);
+}
+
+template< typename RealType >
+void ContinuousDistribution<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = this->f(x[i]);
+}
+
+template< typename RealType >
+void ContinuousDistribution<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    for (size_t i = 0; i != n; ++i)
         y[i] = this->logf(x[i]);
 }
 
+template< typename RealType >
+RealType ContinuousDistribution<RealType>::quantileInitialGuess(double p, bool isComplement) const
+{
+    static constexpr int MAX_EXPANSIONS = 1024, BISECTIONS = 10;
+    /// true if x is less than the quantile
+    auto isBelow = [this, p, isComplement] (const RealType & x)
+    {
+        return isComplement ? this->S(x) > p : this->F(x) < p;
+    };
+    SUPPORT_TYPE suppType = this->SupportType();
+    RealType lower = this->MinValue(), upper = this->MaxValue();
+    if (suppType != FINITE_T) {
+        bool isBoundedBelow = (suppType == RIGHTSEMIFINITE_T), isBoundedAbove = (suppType == LEFTSEMIFINITE_T);
+        /// start from normal approximation, if moments exist
+        double mean = this->Mean(), var = this->Variance();
+        bool isMeanFinite = std::isfinite(mean), isVarFinite = std::isfinite(var) && var > 0;
+        double step = isVarFinite ? std::sqrt(var) : 1.0;
+        double x = isMeanFinite ? mean : 0.0;
+        if (isMeanFinite && isVarFinite) {
+            double z = M_SQRT2 * RandMath::erfcinv(2 * p);
+            x += isComplement ? step * z : -step * z;
+        }
+        if (isBoundedBelow && !(x > lower))
+            x = lower + step;
+        if (isBoundedAbove && !(x < upper))
+            x = upper - step;
+        /// expand the bracket geometrically
+        int iter = 0;
+        if (isBelow(x)) {
+            lower = x;
+            do {
+                upper = lower + step;
+                if (isBoundedAbove && !(upper < this->MaxValue())) {
+                    upper = this->MaxValue();
+                    break;
+                }
+                if (!isBelow(upper))
+                    break;
+                lower = upper;
+                step *= 2;
+            } while (++iter < MAX_EXPANSIONS);
+        }
+        else {
+            upper = x;
+            do {
+                lower = upper - step;
+                if (isBoundedBelow && !(lower > this->MinValue())) {
+                    lower = this->MinValue();
+                    break;
+                }
+                if (isBelow(lower))
+                    break;
+                upper = lower;
+                step *= 2;
+            } while (++iter < MAX_EXPANSIONS);
+        }
+    }
+    /// narrow the bracket
+    for (int i = 0; i != BISECTIONS; ++i) {
+        RealType middle = 0.5 * (lower + upper);
+        if (isBelow(middle))
+            lower = middle;
+        else
+            upper = middle;
+    }
+    return 0.5 * (lower + upper);
+}
+
 template< typename RealType >
 RealType ContinuousDistribution<RealType>::quantileImpl(double p, RealType initValue) const
 {
@@ -55,15 +141,7 @@ RealType ContinuousDistribution<RealType>::quantileImpl(double p, RealType initV
 template< typename RealType >
 RealType ContinuousDistribution<RealType>::quantileImpl(double p) const
 {
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<RealType> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    if (index == 0.0)
-        return this->quantileImpl(p, *std::min_element(sample.begin(), sample.end()));
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end());
-    return this->quantileImpl(p, sample[index]);
+    return this->quantileImpl(p, this->quantileInitialGuess(p, false));
 }
 
 template< typename RealType >
@@ -106,15 +184,7 @@ RealType ContinuousDistribution<RealType>::quantileImpl1m(double p, RealType ini
 template< typename RealType >
 RealType ContinuousDistribution<RealType>::quantileImpl1m(double p) const
 {
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<RealType> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    if (index == 0.0)
-        return this->quantileImpl1m(p, *std::max_element(sample.begin(), sample.end()));
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end(), std::greater<>());
-    return this->quantileImpl1m(p, sample[index]);
+    return this->quantileImpl1m(p, this->quantileInitialGuess(p, true));
 }
 
 template< typename RealType >
@@ -145,67 +215,16 @@ long double ContinuousDistribution<RealType>::ExpectedValue(const std::function<
     if (lowerBoundary >= upperBoundary)
         return 0.0;
 
-    bool isLeftBoundFinite = std::isfinite(lowerBoundary), isRightBoundFinite = std::isfinite(upperBoundary);
-
-    /// Integrate on finite interval [a, b]
-    if (isLeftBoundFinite && isRightBoundFinite) {
-        return RandMath::integral([this, funPtr] (double x)
-        {
-            double y = funPtr(x);
-            return (y == 0.0) ? 0.0 : y * f(x);
-        },
-        lowerBoundary, upperBoundary);
-    }
-
-    /// Integrate on semifinite interval [a, inf)
-    if (isLeftBoundFinite) {
-        return RandMath::integral([this, funPtr, lowerBoundary] (double x)
-        {
-            if (x >= 1.0)
-                return 0.0;
-            double denom = 1.0 - x;
-            double t = lowerBoundary + x / denom;
-            double y = funPtr(t);
-            if (y == 0.0)
-                return 0.0;
-            y *= this->f(t);
-            denom *= denom;
-            return y / denom;
-        },
-        0.0, 1.0);
-    }
-
-    /// Integrate on semifinite intervale (-inf, b]
-    if (isRightBoundFinite) {
-        return RandMath::integral([this, funPtr, upperBoundary] (double x)
-        {
-            if (x <= 0.0)
-                return 0.0;
-            double t = upperBoundary - (1.0 - x) / x;
-            double y = funPtr(t);
-            if (y == 0.0)
-                return 0.0;
-            y *= this->f(t);
-            return y / (x * x);
-        },
-        0.0, 1.0);
-    }
-
-    /// Infinite case
-    return RandMath::integral([this, funPtr] (double x)
+    /// Infinite boundaries are mapped onto finite ones by RandMath::integral
+    return RandMath::integral([this, &funPtr] (double x)
     {
-        if (std::fabs(x) >= 1.0)
-            return 0.0;
-        double x2 = x * x;
-        double denom = 1.0 - x2;
-        double t = x / denom;
-        double y = funPtr(t);
+        double y = funPtr(x);
         if (y == 0.0)
             return 0.0;
-        y *= this->f(t);
-        denom *= denom;
-        return y * (1.0 + x2) / denom;
-    }, -1.0, 1.0);
+        double density = f(x);
+        return (density == 0.0) ? 0.0 : y * density;
+    },
+    lowerBoundary, upperBoundary);
 }
 
 template< typename RealType >
@@ -50,11 +50,45 @@ public:
 
     RealType Mode() const override;
 
+protected:
+    /**
+     * @fn pdfBatch
+     * fills y[i] = f(x[i]) for i = 0, ..., n - 1, called once by ProbabilityDensityFunction.
+     * Distributions with closed-form density override it by a loop without virtual calls
+     * @param x
+     * @param y
+     * @param n
+     */
+    virtual void pdfBatch(const RealType *x, double *y, size_t n) const;
+
+    /**
+     * @fn logpdfBatch
+     * fills y[i] = logf(x[i]) for i = 0, ..., n - 1, called once by LogProbabilityDensityFunction
+     * @param x
+     * @param y
+     * @param n
+     */
+    virtual void logpdfBatch(const RealType *x, double *y, size_t n) const;
+
+private:
+    /**
+     * @fn quantileInitialGuess
+     * brackets the solution of F(x) = p (or S(x) = p if isComplement),
+     * starting from normal approximation by first two moments,
+     * and narrows the bracket by bisection.
+     * Neither allocates nor uses shared state, hence safe for concurrent calls
+     * @param p
+     * @param isComplement
+     * @return initial guess for numerical quantile procedure
+     */
+    RealType quantileInitialGuess(double p, bool isComplement) const;
+
 protected:
     RealType quantileImpl(double p, RealType initValue) const override;
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p, RealType initValue) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return true; }
     long double ExpectedValue(const std::function<double (RealType)> &funPtr, RealType minPoint, RealType maxPoint) const override;
 
 public:
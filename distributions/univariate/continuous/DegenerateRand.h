@@ -40,6 +40,7 @@ public:
 private:
     double quantileImpl(double p) const override;
     double quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
 
     std::complex<double> CFImpl(double t) const override;
 
@@ -81,33 +81,118 @@ double ExponentialRand<RealType>::S(const RealType & x) const
 }
 
 template < typename RealType >
-RealType ExponentialRand<RealType>::Variate() const
+void ExponentialRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
 {
-    return this->theta * StandardVariate(this->localRandGenerator);
+    const double rate = this->beta;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] < 0.0) ? -INFINITY : -rate * x[i];
+    RandMath::vexp(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] *= rate;
 }
 
 template < typename RealType >
-void ExponentialRand<RealType>::Sample(std::vector<RealType> &outputData) const
+void ExponentialRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double rate = this->beta, logRate = this->logBeta;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] < 0.0) ? -INFINITY : logRate - rate * x[i];
+}
+
+template < typename RealType >
+void ExponentialRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double rate = this->beta;
+    /// negative zero for x <= 0 turns into positive one
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] > 0.0) ? -rate * x[i] : -0.0;
+    RandMath::vexpm1(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -y[i];
+}
+
+template < typename RealType >
+void ExponentialRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
 {
-    for (RealType & var : outputData)
-        var = this->Variate();
+    const double rate = this->beta;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] > 0.0) ? -rate * x[i] : 0.0;
+    RandMath::vexp(y, y, n);
 }
 
 template < typename RealType >
+RealType ExponentialRand<RealType>::Variate() const
+{
+    return this->theta * StandardVariate(this->localRandGenerator);
+}
+
+template < typename RealType >
+void ExponentialRand<RealType>::Sample(std::vector<RealType> &outputData) const
+{
+    /// Ziggurat in blocks: uniforms and layers for the whole block are drawn at once,
+    /// fast acceptance is resolved in a loop without branches (vectorizable),
+    /// and the rare rejected positions are regenerated by scalar sampler
+    static constexpr size_t LAYERS = RANDLIB_ZIGGURAT_LAYERS;
+    static constexpr int LAYER_BITS = (LAYERS == 128) ? 7 : ((LAYERS == 256) ? 8 : 10);
+    static constexpr size_t BLOCK_SIZE = 256;
+    const auto &table = ziggurat<LAYERS>;
+    RealType U[BLOCK_SIZE];
+    unsigned int B[BLOCK_SIZE];
+    bool accepted[BLOCK_SIZE];
+    const RealType scale = this->theta;
+    size_t size = outputData.size();
+    for (size_t start = 0; start < size; start += BLOCK_SIZE) {
+        size_t blockSize = std::min(BLOCK_SIZE, size - start);
+        RealType *output = outputData.data() + start;
+        UniformRand<RealType>::template StandardVariates<LAYER_BITS>(this->localRandGenerator, U, B, blockSize);
+        for (size_t i = 0; i != blockSize; ++i) {
+            size_t stairId = B[i] & (LAYERS - 1);
+            output[i] = scale * U[i] * table.x[stairId];
+            accepted[i] = U[i] < table.ratio[stairId];
+        }
+        for (size_t i = 0; i != blockSize; ++i) {
+            if (accepted[i])
+                continue;
+            size_t stairId = B[i] & (LAYERS - 1);
+            RealType x = U[i] * table.x[stairId];
+            if (!zigguratSlowPath<LAYERS>(stairId, x, this->localRandGenerator))
+                x = StandardVariate<LAYERS>(this->localRandGenerator);
+            output[i] = scale * x;
+        }
+    }
+}
+
+template < typename RealType >
+template < size_t LAYERS >
+bool ExponentialRand<RealType>::zigguratSlowPath(size_t stairId, RealType &x, RandGenerator &randGenerator)
+{
+    const auto &table = ziggurat<LAYERS>;
+    if (stairId == 0) /// if we catch the tail
+    {
+        x = table.x[1] + StandardVariate<LAYERS>(randGenerator);
+        return true;
+    }
+    RealType height = table.y[stairId] - table.y[stairId - 1];
+    return table.y[stairId - 1] + height * UniformRand<RealType>::StandardVariate(randGenerator) < std::exp(-x); /// if we are under the curve - accept
+}
+
+template < typename RealType >
+template < size_t LAYERS >
 RealType ExponentialRand<RealType>::StandardVariate(RandGenerator &randGenerator)
 {
     /// Ziggurat algorithm
+    static constexpr int LAYER_BITS = (LAYERS == 128) ? 7 : ((LAYERS == 256) ? 8 : 10);
+    const auto &table = ziggurat<LAYERS>;
     size_t iter = 0;
     do {
-        int stairId = randGenerator.Variate() & 255;
+        /// layer is taken from the bits, which are not used by uniform variate
+        unsigned int B = 0;
+        RealType U = UniformRand<RealType>::template StandardVariate<LAYER_BITS>(randGenerator, B);
+        size_t stairId = B & (LAYERS - 1);
         /// Get horizontal coordinate
-        RealType x = UniformRand<RealType>::StandardVariate(randGenerator) * ziggurat[stairId].second;
-        if (x < ziggurat[stairId + 1].second) /// if we are under the upper stair - accept
-            return x;
-        if (stairId == 0) /// if we catch the tail
-            return ziggurat[1].second + StandardVariate(randGenerator);
-        RealType height = ziggurat[stairId].first - ziggurat[stairId - 1].first;
-        if (ziggurat[stairId - 1].first + height * UniformRand<RealType>::StandardVariate(randGenerator) < std::exp(-x)) /// if we are under the curve - accept
+        RealType x = U * table.x[stairId];
+        /// if we are under the upper stair - accept
+        if (U < table.ratio[stairId] || zigguratSlowPath<LAYERS>(stairId, x, randGenerator))
             return x;
         /// rejection - go back
     } while (++iter <= ProbabilityDistribution<RealType>::MAX_ITER_REJECTION);
@@ -141,3 +226,13 @@ long double ExponentialRand<RealType>::Moment(int n) const
 template class ExponentialRand<float>;
 template class ExponentialRand<double>;
 template class ExponentialRand<long double>;
+
+template float ExponentialRand<float>::StandardVariate<128>(RandGenerator &);
+template float ExponentialRand<float>::StandardVariate<256>(RandGenerator &);
+template float ExponentialRand<float>::StandardVariate<1024>(RandGenerator &);
+template double ExponentialRand<double>::StandardVariate<128>(RandGenerator &);
+template double ExponentialRand<double>::StandardVariate<256>(RandGenerator &);
+template double ExponentialRand<double>::StandardVariate<1024>(RandGenerator &);
+template long double ExponentialRand<long double>::StandardVariate<128>(RandGenerator &);
+template long double ExponentialRand<long double>::StandardVariate<256>(RandGenerator &);
+template long double ExponentialRand<long double>::StandardVariate<1024>(RandGenerator &);
@@ -8,27 +8,27 @@
  * @brief The ExpZiggurat class
  * Class for ziggurat making
  * (for exponentially distributed random data generation)
+ * @tparam LAYERS amount of layers: 128, 256 or 1024
  */
+template < size_t LAYERS >
 class RANDLIBSHARED_EXPORT ExpZiggurat {
+    static_assert(LAYERS == 128 || LAYERS == 256 || LAYERS == 1024, "Ziggurat should have 128, 256 or 1024 layers");
 
-    static constexpr size_t TABLE_SIZE = 257;
-    static constexpr std::array<LongDoublePair, TABLE_SIZE> createZiggurat()
+    /// start of the tail
+    static constexpr long double R = (LAYERS == 128) ? 6.89831511661564260578l :
+                                     (LAYERS == 256) ? 7.69711747013104971397l : 9.25616454426554368697l;
+    /// area under each layer
+    static constexpr long double V = (LAYERS == 128) ? 7.97322953955348999388e-3l :
+                                     (LAYERS == 256) ? 3.94965982258155722010e-3l : 9.79678990662020916574e-4l;
+
+    template < typename T >
+    static constexpr RandMath::ZigguratTable<T, LAYERS> createZiggurat()
     {
-        constexpr long double A = 3.9496598225815571993e-3l; /// area under rectangle
-        std::array<LongDoublePair, TABLE_SIZE> table{};
-        /// coordinates of the implicit rectangle in base layer
-        table[0].first = 0.00045413435384149675l; /// exp(-x1);
-        table[0].second = 8.697117470131049720307l; /// A / stairHeight[0];
-        /// implicit value for the top layer
-        table[TABLE_SIZE - 1].second = 0;
-        table[1].second = 7.69711747013104972l;
-        table[1].first = 0.0009672692823271745203l;
-        for (size_t i = 2; i < TABLE_SIZE - 1; ++i) {
-            /// such y_i that f(x_{i+1}) = y_i
-            table[i].second = -std::log(table[i - 1].first);
-            table[i].first = table[i - 1].first + A / table[i].second;
-        }
-        return table;
+        return RandMath::createZiggurat<T, LAYERS>(R, V, [] (long double x) {
+            return std::exp(-x);
+        }, [] (long double y) {
+            return -std::log(y);
+        });
     }
 
     template < typename RealType >
@@ -50,7 +50,10 @@ template < typename RealType = double >
 class RANDLIBSHARED_EXPORT ExponentialRand : public FreeRateGammaDistribution<RealType>,
                                              public ExponentialFamily<RealType, double>
 {
-    static constexpr auto ziggurat = ExpZiggurat::createZiggurat();
+    /// tables are stored in float for float variates and in double otherwise
+    using ZigguratType = typename std::conditional<std::is_same<RealType, float>::value, float, double>::type;
+    template < size_t LAYERS >
+    static constexpr RandMath::ZigguratTable<ZigguratType, LAYERS> ziggurat = ExpZiggurat<LAYERS>::template createZiggurat<ZigguratType>();
 
 public:
     explicit ExponentialRand(double rate = 1) : FreeRateGammaDistribution<RealType>(1, rate) {}
@@ -71,9 +74,33 @@ public:
     double S(const RealType & x) const override;
     RealType Variate() const override;
     void Sample(std::vector<RealType> &outputData) const override;
+    /**
+     * @fn StandardVariate
+     * @tparam LAYERS amount of layers in ziggurat: 128, 256 or 1024
+     * @param randGenerator
+     * @return standard exponential variate
+     */
+    template < size_t LAYERS = RANDLIB_ZIGGURAT_LAYERS >
     static RealType StandardVariate(RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
 
 private:
+    /**
+     * @fn zigguratSlowPath
+     * handles the base layer and the wedges of ziggurat
+     * for the point, which wasn't accepted by the fast test
+     * @param stairId layer
+     * @param x horizontal coordinate in input, variate in output
+     * @param randGenerator
+     * @return true if point is accepted
+     */
+    template < size_t LAYERS >
+    static bool zigguratSlowPath(size_t stairId, RealType &x, RandGenerator &randGenerator);
+
+    void pdfBatch(const RealType *x, double *y, size_t n) const override;
+    void logpdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfComplBatch(const RealType *x, double *y, size_t n) const override;
+
     std::complex<double> CFImpl(double t) const override;
 
 public:
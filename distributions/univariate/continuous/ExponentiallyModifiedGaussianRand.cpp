@@ -105,6 +105,13 @@ void ExponentiallyModifiedGaussianRand<RealType>::Reseed(unsigned long seed) con
     Y.Reseed(seed + 1);
 }
 
+template < typename RealType >
+void ExponentiallyModifiedGaussianRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    X.Discard(variatesNum);
+    Y.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double ExponentiallyModifiedGaussianRand<RealType>::Mean() const
 {
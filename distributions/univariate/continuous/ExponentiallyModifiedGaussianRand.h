@@ -49,6 +49,7 @@ public:
     RealType Variate() const override;
     static RealType StandardVariate(RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
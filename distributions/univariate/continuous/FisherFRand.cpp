@@ -92,6 +92,12 @@ void FisherFRand<RealType>::Reseed(unsigned long seed) const
     B.Reseed(seed);
 }
 
+template < typename RealType >
+void FisherFRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    B.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double FisherFRand<RealType>::Mean() const
 {
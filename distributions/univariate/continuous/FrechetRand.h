@@ -47,6 +47,7 @@ public:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
 
 public:
     long double Entropy() const;
@@ -90,6 +90,73 @@ double GammaDistribution<RealType>::S(const RealType & x) const
     return (x > 0.0) ? RandMath::qgamma(this->alpha, x * this->beta, logAlpha, lgammaAlpha) : 1.0;
 }
 
+template < typename RealType >
+void GammaDistribution<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    logpdfBatch(x, y, n);
+    RandMath::vexp(y, y, n);
+}
+
+template < typename RealType >
+void GammaDistribution<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shapem1 = this->alpha - 1.0, rate = this->beta, coef = pdfCoef;
+    const double atZero = (this->alpha > 1.0) ? -INFINITY : ((this->alpha == 1.0) ? this->logBeta : INFINITY);
+    double logX[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            logX[i] = (x[start + i] > 0.0) ? x[start + i] : 1.0;
+        RandMath::vlog(logX, logX, size);
+        for (size_t i = 0; i != size; ++i) {
+            const RealType xi = x[start + i];
+            if (xi > 0.0) {
+                double z = shapem1 * logX[i];
+                z -= xi * rate;
+                y[start + i] = z + coef;
+            }
+            else if (xi < 0.0)
+                y[start + i] = -INFINITY;
+            else /// zero or NaN, which is propagated as in logf
+                y[start + i] = (xi == 0.0) ? atZero : xi;
+        }
+    }
+}
+
+template < typename RealType >
+void GammaDistribution<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape = this->alpha, rate = this->beta, logShape = logAlpha, lgammaShape = lgammaAlpha;
+    double z[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            z[i] = (x[start + i] > 0.0) ? x[start + i] * rate : 0.0;
+        RandMath::pgamma(shape, z, logShape, lgammaShape, y + start, size);
+        for (size_t i = 0; i != size; ++i) {
+            if (z[i] == 0.0)
+                y[start + i] = 0.0;
+        }
+    }
+}
+
+template < typename RealType >
+void GammaDistribution<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape = this->alpha, rate = this->beta, logShape = logAlpha, lgammaShape = lgammaAlpha;
+    double z[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            z[i] = (x[start + i] > 0.0) ? x[start + i] * rate : 0.0;
+        RandMath::qgamma(shape, z, logShape, lgammaShape, y + start, size);
+        for (size_t i = 0; i != size; ++i) {
+            if (z[i] == 0.0)
+                y[start + i] = 1.0;
+        }
+    }
+}
+
 template < typename RealType >
 double GammaDistribution<RealType>::logS(const RealType &x) const
 {
@@ -181,9 +248,14 @@ RealType GammaDistribution<RealType>::variateFishman(double shape, RandGenerator
 template < typename RealType >
 RealType GammaDistribution<RealType>::variateMarsagliaTsang(double shape, RandGenerator &randGenerator)
 {
-    /// Marsaglia and Tsang’s Method (shape > 1/3)
     RealType d = shape - 1.0 / 3;
-    RealType c = 3 * std::sqrt(d);
+    return variateMarsagliaTsang(d, 3 * std::sqrt(d), randGenerator);
+}
+
+template < typename RealType >
+RealType GammaDistribution<RealType>::variateMarsagliaTsang(RealType d, RealType c, RandGenerator &randGenerator)
+{
+    /// Marsaglia and Tsang’s Method (shape >= 1)
     size_t iter = 0;
     do {
         RealType N;
@@ -235,6 +307,68 @@ RealType GammaDistribution<RealType>::Variate(double shape, double rate, RandGen
     return StandardVariate(shape, randGenerator) / rate;
 }
 
+template < typename RealType >
+void GammaDistribution<RealType>::StandardVariates(const std::vector<double> &shapes, std::vector<RealType> &outputData, RandGenerator &randGenerator)
+{
+    for (double shape : shapes) {
+        if (!(shape > 0))
+            throw std::invalid_argument("Gamma distribution: shape should be positive");
+    }
+    outputData.resize(shapes.size());
+
+    /// elements are processed in blocks, which fit into cache:
+    /// indices are grouped by used generator and each group is sampled in a separate loop
+    static constexpr size_t BLOCK_SIZE = 256;
+    size_t groups[MARSAGLIA_TSANG + 1][BLOCK_SIZE];
+    RealType d[BLOCK_SIZE], c[BLOCK_SIZE];
+    for (size_t start = 0; start < shapes.size(); start += BLOCK_SIZE) {
+        size_t end = std::min(start + BLOCK_SIZE, shapes.size());
+        size_t groupSize[MARSAGLIA_TSANG + 1] = {0};
+        for (size_t i = start; i != end; ++i) {
+            GENERATOR_ID genId = getIdOfUsedGenerator(shapes[i]);
+            groups[genId][groupSize[genId]++] = i;
+        }
+
+        for (size_t j = 0; j != groupSize[INTEGER_SHAPE]; ++j) {
+            size_t i = groups[INTEGER_SHAPE][j];
+            outputData[i] = variateThroughExponentialSum(std::round(shapes[i]), randGenerator);
+        }
+        for (size_t j = 0; j != groupSize[ONE_AND_A_HALF_SHAPE]; ++j)
+            outputData[groups[ONE_AND_A_HALF_SHAPE][j]] = variateForShapeOneAndAHalf(randGenerator);
+        for (size_t j = 0; j != groupSize[SMALL_SHAPE]; ++j) {
+            size_t i = groups[SMALL_SHAPE][j];
+            outputData[i] = variateAhrensDieter(shapes[i], randGenerator);
+        }
+        for (size_t j = 0; j != groupSize[FISHMAN]; ++j) {
+            size_t i = groups[FISHMAN][j];
+            outputData[i] = variateFishman(shapes[i], randGenerator);
+        }
+
+        /// setup of Marsaglia-Tsang algorithm is computed in a separate loop without branches
+        const size_t *group = groups[MARSAGLIA_TSANG];
+        for (size_t j = 0; j != groupSize[MARSAGLIA_TSANG]; ++j) {
+            d[j] = shapes[group[j]] - 1.0 / 3;
+            c[j] = 3 * std::sqrt(d[j]);
+        }
+        for (size_t j = 0; j != groupSize[MARSAGLIA_TSANG]; ++j)
+            outputData[group[j]] = variateMarsagliaTsang(d[j], c[j], randGenerator);
+    }
+}
+
+template < typename RealType >
+void GammaDistribution<RealType>::Variates(const std::vector<double> &shapes, const std::vector<double> &rates, std::vector<RealType> &outputData, RandGenerator &randGenerator)
+{
+    if (shapes.size() != rates.size())
+        throw std::invalid_argument("Gamma distribution: sizes of shapes and rates should coincide");
+    for (double rate : rates) {
+        if (!(rate > 0.0))
+            throw std::invalid_argument("Gamma distribution: rate should be positive");
+    }
+    StandardVariates(shapes, outputData, randGenerator);
+    for (size_t i = 0; i != outputData.size(); ++i)
+        outputData[i] /= rates[i];
+}
+
 template < typename RealType >
 RealType GammaDistribution<RealType>::Variate() const
 {
@@ -550,6 +684,12 @@ RealType GammaDistribution<RealType>::quantileImpl1m(double p) const
     return (this->alpha == 1.0) ? -theta * std::log(p) : quantileImpl1m(p, quantileInitialGuess1m(p));
 }
 
+template < typename RealType >
+bool GammaDistribution<RealType>::canWarmStartQuantile() const
+{
+    return this->alpha != 1.0;
+}
+
 template < typename RealType >
 std::complex<double> GammaDistribution<RealType>::CFImpl(double t) const
 {
@@ -108,9 +108,9 @@ private:
     enum GENERATOR_ID {
         INTEGER_SHAPE, ///< Erlang distribution for α = 1, 2, 3
         ONE_AND_A_HALF_SHAPE, ///< α = 1.5
-        SMALL_SHAPE, ///< α < 0.34
+        SMALL_SHAPE, ///< α < 1
         FISHMAN, ///< 1 < α < 1.2
-        MARSAGLIA_TSANG ///< 0.34 < α < 1 or α >= 1.2
+        MARSAGLIA_TSANG ///< α >= 1.2
     };
 
     /**
@@ -120,7 +120,8 @@ private:
      */
     static GENERATOR_ID getIdOfUsedGenerator(double shape)
     {
-        if (shape < 0.34)
+        /// Marsaglia-Tsang method is exact only for α >= 1
+        if (shape < 1.0)
             return SMALL_SHAPE;
         if (shape <= 3.0 && RandMath::areClose(shape, std::round(shape)))
             return INTEGER_SHAPE;
@@ -165,6 +166,13 @@ private:
      * @return gamma variate, using Marsaglia-Tsang algorithm
      */
     static RealType variateMarsagliaTsang(double shape, RandGenerator& randGenerator);
+    /**
+     * @fn variateMarsagliaTsang
+     * @param d α - 1/3
+     * @param c 3 * sqrt(d)
+     * @return gamma variate, using Marsaglia-Tsang algorithm with precomputed constants
+     */
+    static RealType variateMarsagliaTsang(RealType d, RealType c, RandGenerator& randGenerator);
     
 public:
     /**
@@ -180,6 +188,21 @@ public:
      * @return gamma variate with shape α and rate β
      */
     static RealType Variate(double shape, double rate, RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
+    /**
+     * @fn StandardVariates
+     * one variate per shape: elements are grouped by used generator
+     * and setup constants of each group are computed in a separate loop
+     * @param shapes α
+     * @param outputData gamma variates with shapes α and unity rate
+     */
+    static void StandardVariates(const std::vector<double> &shapes, std::vector<RealType> &outputData, RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
+    /**
+     * @fn Variates
+     * @param shapes α
+     * @param rates β
+     * @param outputData gamma variates with shapes α and rates β
+     */
+    static void Variates(const std::vector<double> &shapes, const std::vector<double> &rates, std::vector<RealType> &outputData, RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
 
     RealType Variate() const override;
     void Sample(std::vector<RealType> &outputData) const override;
@@ -237,6 +260,12 @@ private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p, RealType initValue) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override;
+
+    void pdfBatch(const RealType *x, double *y, size_t n) const override;
+    void logpdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfComplBatch(const RealType *x, double *y, size_t n) const override;
 
     std::complex<double> CFImpl(double t) const override;
 };
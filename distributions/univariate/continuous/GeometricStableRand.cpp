@@ -432,6 +432,12 @@ void GeneralGeometricStableDistribution<RealType>::Reseed(unsigned long seed) co
     Z.Reseed(seed);
 }
 
+template < typename RealType >
+void GeneralGeometricStableDistribution<RealType>::Discard(unsigned long long variatesNum) const
+{
+    Z.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double GeneralGeometricStableDistribution<RealType>::Mean() const
 {
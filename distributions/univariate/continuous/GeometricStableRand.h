@@ -84,6 +84,7 @@ public:
     RealType Variate() const override;
     void Sample(std::vector<RealType> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
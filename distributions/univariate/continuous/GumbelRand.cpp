@@ -59,6 +59,55 @@ double GumbelRand<RealType>::S(const RealType &x) const
     return -std::expm1l(-y);
 }
 
+template < typename RealType >
+void GumbelRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    logpdfBatch(x, y, n);
+    RandMath::vexp(y, y, n);
+}
+
+template < typename RealType >
+void GumbelRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = mu, scale = beta, logScale = logBeta;
+    double expZ[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        double *z = y + start;
+        for (size_t i = 0; i != size; ++i)
+            z[i] = (location - x[start + i]) / scale;
+        RandMath::vexp(z, expZ, size);
+        for (size_t i = 0; i != size; ++i)
+            z[i] = z[i] - expZ[i] - logScale;
+    }
+}
+
+template < typename RealType >
+void GumbelRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = mu, scale = beta;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (location - x[i]) / scale;
+    RandMath::vexp(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -y[i];
+    RandMath::vexp(y, y, n);
+}
+
+template < typename RealType >
+void GumbelRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = mu, scale = beta;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (location - x[i]) / scale;
+    RandMath::vexp(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -y[i];
+    RandMath::vexpm1(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -y[i];
+}
+
 template < typename RealType >
 RealType GumbelRand<RealType>::Variate() const
 {
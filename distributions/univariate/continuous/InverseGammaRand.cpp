@@ -69,6 +69,12 @@ void InverseGammaRand<RealType>::Reseed(unsigned long seed) const
     X.Reseed(seed);
 }
 
+template < typename RealType >
+void InverseGammaRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    X.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double InverseGammaRand<RealType>::Mean() const
 {
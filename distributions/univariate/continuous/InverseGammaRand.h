@@ -41,6 +41,7 @@ public:
     RealType Variate() const override;
     void Sample(std::vector<RealType> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
@@ -52,6 +53,7 @@ public:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
 
 public:
     double GetLogGammaShape() const { return X.GetLogGammaShape(); }
@@ -95,6 +95,12 @@ void IrwinHallRand<RealType>::Reseed(unsigned long seed) const
     U.Reseed(seed);
 }
 
+template < typename RealType >
+void IrwinHallRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    U.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double IrwinHallRand<RealType>::Mean() const
 {
@@ -215,9 +215,8 @@ RealType KolmogorovSmirnovRand<RealType>::Median() const
 }
 
 template < typename RealType >
-RealType KolmogorovSmirnovRand<RealType>::quantileImpl(double p) const
+RealType KolmogorovSmirnovRand<RealType>::quantileImpl(double p, RealType initValue) const
 {
-    RealType guess = std::sqrt(-0.5 * (std::log1pl(-p) - M_LN2));
     if (p < 1e-5) {
         double logP = std::log(p);
         if (!RandMath::findRootNewtonFirstOrder<RealType>([this, logP] (RealType x)
@@ -226,24 +225,29 @@ RealType KolmogorovSmirnovRand<RealType>::quantileImpl(double p) const
             double first = logCdf - logP;
             double second = std::exp(logPdf - logCdf);
             return DoublePair(first, second);
-        }, guess))
+        }, initValue))
             throw std::runtime_error("Kolmogorov-Smirnov distribution: failure in numerical procedure");
-        return guess;
+        return initValue;
     }
     if (!RandMath::findRootNewtonFirstOrder<RealType>([p, this] (RealType x)
     {
         double first = F(x) - p;
         double second = f(x);
         return DoublePair(first, second);
-    }, guess))
+    }, initValue))
         throw std::runtime_error("Kolmogorov-Smirnov distribution: failure in numerical procedure");
-    return guess;
+    return initValue;
 }
 
 template < typename RealType >
-RealType KolmogorovSmirnovRand<RealType>::quantileImpl1m(double p) const
+RealType KolmogorovSmirnovRand<RealType>::quantileImpl(double p) const
+{
+    return quantileImpl(p, std::sqrt(-0.5 * (std::log1pl(-p) - M_LN2)));
+}
+
+template < typename RealType >
+RealType KolmogorovSmirnovRand<RealType>::quantileImpl1m(double p, RealType initValue) const
 {
-    RealType guess = std::sqrt(-0.5 * std::log(0.5 * p));
     if (p < 1e-5) {
         double logP = std::log(p);
         if (!RandMath::findRootNewtonFirstOrder<RealType>([this, logP] (RealType x)
@@ -252,18 +256,24 @@ RealType KolmogorovSmirnovRand<RealType>::quantileImpl1m(double p) const
             double first = logP - logCcdf;
             double second = std::exp(logPdf - logCcdf);
             return DoublePair(first, second);
-        }, guess))
+        }, initValue))
             throw std::runtime_error("Kolmogorov-Smirnov distribution: failure in numerical procedure");
-        return guess;
+        return initValue;
     }
     if (!RandMath::findRootNewtonFirstOrder<RealType>([p, this] (RealType x)
     {
         double first = p - S(x);
         double second = f(x);
         return DoublePair(first, second);
-    }, guess))
+    }, initValue))
         throw std::runtime_error("Kolmogorov-Smirnov distribution: failure in numerical procedure");
-    return guess;
+    return initValue;
+}
+
+template < typename RealType >
+RealType KolmogorovSmirnovRand<RealType>::quantileImpl1m(double p) const
+{
+    return quantileImpl1m(p, std::sqrt(-0.5 * std::log(0.5 * p)));
 }
 
 
@@ -43,7 +43,9 @@ public:
     RealType Median() const override;
 
 private:
+    RealType quantileImpl(double p, RealType initValue) const override;
     RealType quantileImpl(double p) const override;
+    RealType quantileImpl1m(double p, RealType initValue) const override;
     RealType quantileImpl1m(double p) const override;
 };
 
@@ -49,6 +49,49 @@ double AsymmetricLaplaceDistribution<RealType>::S(const RealType & x) const
     return this->cdfLaplaceCompl(x - this->m);
 }
 
+template < typename RealType >
+void AsymmetricLaplaceDistribution<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    logpdfBatch(x, y, n);
+    RandMath::vexp(y, y, n);
+}
+
+template < typename RealType >
+void AsymmetricLaplaceDistribution<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shift = this->m, scale = this->gamma, leftRate = this->kappaInv, rightRate = -this->kappa;
+    const double coef = this->logKappa - this->logGamma - this->log1pKappaSq;
+    for (size_t i = 0; i != n; ++i) {
+        double z = x[i] - shift;
+        double rate = (z < 0) ? leftRate : rightRate;
+        y[i] = rate * (z / scale) + coef;
+    }
+}
+
+template < typename RealType >
+void AsymmetricLaplaceDistribution<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shift = this->m, scale = this->gamma, leftRate = this->kappaInv, rightRate = this->kappa;
+    const double leftCoef = 2 * this->logKappa - this->log1pKappaSq, rightCoef = this->log1pKappaSq;
+    for (size_t i = 0; i != n; ++i) {
+        double z = x[i] - shift;
+        z /= scale;
+        y[i] = (z < 0) ? std::exp(leftRate * z + leftCoef) : -std::expm1(-rightCoef - rightRate * z);
+    }
+}
+
+template < typename RealType >
+void AsymmetricLaplaceDistribution<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shift = this->m, scale = this->gamma, leftRate = this->kappaInv, rightRate = this->kappa;
+    const double leftCoef = 2 * this->logKappa - this->log1pKappaSq, rightCoef = this->log1pKappaSq;
+    for (size_t i = 0; i != n; ++i) {
+        double z = x[i] - shift;
+        z /= scale;
+        y[i] = (z < 0) ? -std::expm1(leftRate * z + leftCoef) : std::exp(-rightCoef - rightRate * z);
+    }
+}
+
 template < typename RealType >
 RealType AsymmetricLaplaceDistribution<RealType>::Variate() const
 {
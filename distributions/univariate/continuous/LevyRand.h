@@ -36,6 +36,7 @@ public:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
 
     std::complex<double> CFImpl(double t) const override;
 
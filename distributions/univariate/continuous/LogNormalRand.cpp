@@ -32,7 +32,7 @@ void LogNormalRand<RealType>::SetScale(double scale)
 template < typename RealType >
 double LogNormalRand<RealType>::f(const RealType & x) const
 {
-    return (x > 0.0) ? std::exp(logf(x)) : 0.0;
+    return (x <= 0.0) ? 0.0 : std::exp(logf(x));
 }
 
 template < typename RealType >
@@ -57,12 +57,79 @@ double LogNormalRand<RealType>::S(const RealType & x) const
     return (x > 0.0) ? X.S(std::log(x)) : 1.0;
 }
 
+template < typename RealType >
+void LogNormalRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    logpdfBatch(x, y, n);
+    RandMath::vexp(y, y, n);
+}
+
+template < typename RealType >
+void LogNormalRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    /// log-density of X, expanded to avoid virtual calls
+    const double location = X.GetLocation(), halfScaleInv = M_SQRT1_2 / X.GetScale();
+    const double coef = std::log(X.GetScale()) + 0.5 * (M_LN2 + M_LNPI);
+    double logX[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            logX[i] = (x[start + i] > 0.0) ? x[start + i] : 1.0;
+        RandMath::vlog(logX, logX, size);
+        for (size_t i = 0; i != size; ++i) {
+            if (x[start + i] > 0.0) {
+                double z = (logX[i] - location) * halfScaleInv;
+                y[start + i] = -(z * z + coef) - logX[i];
+            }
+            else /// NaN is propagated as in logf
+                y[start + i] = (x[start + i] <= 0.0) ? -INFINITY : x[start + i];
+        }
+    }
+}
+
+template < typename RealType >
+void LogNormalRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = X.GetLocation(), halfScaleInv = M_SQRT1_2 / X.GetScale();
+    double logX[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            logX[i] = (x[start + i] > 0.0) ? x[start + i] : 1.0;
+        RandMath::vlog(logX, logX, size);
+        for (size_t i = 0; i != size; ++i)
+            y[start + i] = (x[start + i] > 0.0) ? 0.5 * std::erfc((location - logX[i]) * halfScaleInv) : 0.0;
+    }
+}
+
+template < typename RealType >
+void LogNormalRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = X.GetLocation(), halfScaleInv = M_SQRT1_2 / X.GetScale();
+    double logX[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            logX[i] = (x[start + i] > 0.0) ? x[start + i] : 1.0;
+        RandMath::vlog(logX, logX, size);
+        for (size_t i = 0; i != size; ++i)
+            y[start + i] = (x[start + i] > 0.0) ? 0.5 * std::erfc((logX[i] - location) * halfScaleInv) : 1.0;
+    }
+}
+
 template < typename RealType >
 RealType LogNormalRand<RealType>::Variate() const
 {
     return std::exp(X.Variate());
 }
 
+template < typename RealType >
+void LogNormalRand<RealType>::Sample(std::vector<RealType> &outputData) const
+{
+    X.Sample(outputData);
+    RandMath::vexp(outputData.data(), outputData.data(), outputData.size());
+}
+
 template < typename RealType >
 RealType LogNormalRand<RealType>::StandardVariate(RandGenerator &randGenerator)
 {
@@ -75,6 +142,12 @@ void LogNormalRand<RealType>::Reseed(unsigned long seed) const
     X.Reseed(seed);
 }
 
+template < typename RealType >
+void LogNormalRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    X.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double LogNormalRand<RealType>::Mean() const
 {
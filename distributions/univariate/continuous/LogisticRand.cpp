@@ -31,7 +31,8 @@ void LogisticRand<RealType>::SetScale(double scale)
 template < typename RealType >
 double LogisticRand<RealType>::f(const RealType & x) const
 {
-    double numerator = std::exp((mu - x) / s);
+    /// density is symmetric, negative exponent keeps numerator from overflow
+    double numerator = std::exp(-std::fabs((mu - x) / s));
     double denominator = (1 + numerator);
     denominator *= denominator;
     denominator *= s;
@@ -41,7 +42,9 @@ double LogisticRand<RealType>::f(const RealType & x) const
 template < typename RealType >
 double LogisticRand<RealType>::logf(const RealType & x) const
 {
-    double x0 = (mu - x) / s;
+    /// density is symmetric, so x0 - 2 * softplus(x0) = -|x0| - 2 * softplus(-|x0|),
+    /// which stays finite in both tails
+    double x0 = -std::fabs((mu - x) / s);
     double y = RandMath::softplus(x0);
     y *= 2;
     y += logS;
@@ -58,8 +61,64 @@ double LogisticRand<RealType>::F(const RealType & x) const
 template < typename RealType >
 double LogisticRand<RealType>::S(const RealType & x) const
 {
-    double expX = std::exp((mu - x) / s);
-    return expX / (1 + expX);
+    double expX = std::exp((x - mu) / s);
+    return 1.0 / (1 + expX);
+}
+
+template < typename RealType >
+void LogisticRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = mu, scale = s;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -std::fabs((location - x[i]) / scale);
+    RandMath::vexp(y, y, n);
+    for (size_t i = 0; i != n; ++i) {
+        double numerator = y[i];
+        double denominator = (1 + numerator);
+        denominator *= denominator;
+        denominator *= scale;
+        y[i] = numerator / denominator;
+    }
+}
+
+template < typename RealType >
+void LogisticRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = mu, scale = s, logScale = logS;
+    double z[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        /// density is symmetric, so x0 - 2 * softplus(x0) = -|x0| - 2 * log(1 + exp(-|x0|))
+        double *x0 = y + start;
+        for (size_t i = 0; i != size; ++i)
+            x0[i] = -std::fabs((location - x[start + i]) / scale);
+        RandMath::vexp(x0, z, size);
+        RandMath::vlog1p(z, z, size);
+        for (size_t i = 0; i != size; ++i)
+            x0[i] -= 2 * z[i] + logScale;
+    }
+}
+
+template < typename RealType >
+void LogisticRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = mu, scale = s;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (location - x[i]) / scale;
+    RandMath::vexp(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = 1.0 / (1 + y[i]);
+}
+
+template < typename RealType >
+void LogisticRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = mu, scale = s;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] - location) / scale;
+    RandMath::vexp(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = 1.0 / (1 + y[i]);
 }
 
 template < typename RealType >
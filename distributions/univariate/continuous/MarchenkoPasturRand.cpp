@@ -235,6 +235,13 @@ void MarchenkoPasturRand<RealType>::Reseed(unsigned long seed) const
     BetaRV.Reseed(seed + 1);
 }
 
+template < typename RealType >
+void MarchenkoPasturRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    BetaRV.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double MarchenkoPasturRand<RealType>::Moment(int n) const
 {
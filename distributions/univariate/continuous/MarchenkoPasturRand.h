@@ -80,6 +80,7 @@ public:
     RealType Variate() const override;
     void Sample(std::vector<RealType> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
 private:
     long double Moment(int n) const;
@@ -94,6 +95,8 @@ public:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    /// atom at zero is not covered by quantileImpl(p, initValue)
+    bool canWarmStartQuantile() const override { return false; }
     std::complex<double> CFImpl(double t) const override;
 };
 
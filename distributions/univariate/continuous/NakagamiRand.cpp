@@ -80,6 +80,13 @@ void NakagamiDistribution<RealType>::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+template < typename RealType >
+void NakagamiDistribution<RealType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    Y.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double NakagamiDistribution<RealType>::Mean() const
 {
@@ -145,6 +145,13 @@ void NoncentralChiSquaredRand<RealType>::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+template < typename RealType >
+void NoncentralChiSquaredRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    Y.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double NoncentralChiSquaredRand<RealType>::Mean() const
 {
@@ -103,6 +103,44 @@ double NormalRand<RealType>::S(const RealType & x) const
     return this->cdfNormalCompl(x);
 }
 
+template < typename RealType >
+void NormalRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    logpdfBatch(x, y, n);
+    RandMath::vexp(y, y, n);
+}
+
+template < typename RealType >
+void NormalRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = this->mu, halfScaleInv = 0.5 / this->gamma, coef = this->pdfCoef;
+    for (size_t i = 0; i != n; ++i) {
+        double z = x[i] - location;
+        z *= halfScaleInv;
+        y[i] = -(z * z + coef);
+    }
+}
+
+template < typename RealType >
+void NormalRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = this->mu, halfScaleInv = 0.5 / this->gamma;
+    for (size_t i = 0; i != n; ++i) {
+        double z = location - x[i];
+        y[i] = 0.5 * std::erfc(z * halfScaleInv);
+    }
+}
+
+template < typename RealType >
+void NormalRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double location = this->mu, halfScaleInv = 0.5 / this->gamma;
+    for (size_t i = 0; i != n; ++i) {
+        double z = x[i] - location;
+        y[i] = 0.5 * std::erfc(z * halfScaleInv);
+    }
+}
+
 template < typename RealType >
 RealType NormalRand<RealType>::Variate() const
 {
@@ -110,38 +148,46 @@ RealType NormalRand<RealType>::Variate() const
 }
 
 template < typename RealType >
+template < size_t LAYERS >
+bool NormalRand<RealType>::zigguratSlowPath(size_t stairId, RealType &x, RandGenerator &randGenerator)
+{
+    const auto &table = ziggurat<LAYERS>;
+    if (stairId == 0) /// handle the base layer
+    {
+        /// the tail is sampled from fresh variates only, so that the output
+        /// is determined by the state of the generator
+        const RealType r = table.x[1];
+        RealType z;
+        do {
+            x = ExponentialRand<RealType>::StandardVariate(randGenerator) / r;
+            z = ExponentialRand<RealType>::StandardVariate(randGenerator) - 0.5 * x * x;
+        } while (z <= 0);
+        x += r;
+        return true;
+    }
+    /// handle the wedges of other stairs
+    RealType height = table.y[stairId] - table.y[stairId - 1];
+    return table.y[stairId - 1] + height * UniformRand<RealType>::StandardVariate(randGenerator) < std::exp(-.5 * x * x);
+}
+
+template < typename RealType >
+template < size_t LAYERS >
 RealType NormalRand<RealType>::StandardVariate(RandGenerator &randGenerator)
 {
-    /// Ziggurat algorithm by George Marsaglia using 256 strips
+    /// Ziggurat algorithm by George Marsaglia
+    static constexpr int LAYER_BITS = (LAYERS == 128) ? 7 : ((LAYERS == 256) ? 8 : 10);
+    const auto &table = ziggurat<LAYERS>;
     size_t iter = 0;
     do {
-        unsigned long long B = randGenerator.Variate();
-        int stairId = B & 255;
-        RealType x = UniformRand<RealType>::StandardVariate(randGenerator) * ziggurat[stairId].second; /// Get horizontal coordinate
-        if (x < ziggurat[stairId + 1].second)
-            return ((signed)B > 0) ? x : -x;
-        if (stairId == 0) /// handle the base layer
-        {
-            static thread_local RealType z = -1;
-            if (z > 0) /// we don't have to generate another exponential variable as we already have one
-            {
-                x = ExponentialRand<RealType>::StandardVariate(randGenerator) / ziggurat[1].second;
-                z -= 0.5 * x * x;
-            }
-            if (z <= 0) /// if previous generation wasn't successful
-            {
-                do {
-                    x = ExponentialRand<RealType>::StandardVariate(randGenerator) / ziggurat[1].second;
-                    z = ExponentialRand<RealType>::StandardVariate(randGenerator) - 0.5 * x * x; /// we storage this value as after acceptance it becomes exponentially distributed
-                } while (z <= 0);
-            }
-            x += ziggurat[1].second;
-            return ((signed)B > 0) ? x : -x;
-        }
-        /// handle the wedges of other stairs
-        RealType height = ziggurat[stairId].first - ziggurat[stairId - 1].first;
-        if (ziggurat[stairId - 1].first + height * UniformRand<RealType>::StandardVariate(randGenerator) < std::exp(-.5 * x * x))
-            return ((signed)B > 0) ? x : -x;
+        /// layer and sign are taken from the bits, which are not used by uniform variate
+        unsigned int B = 0;
+        RealType U = UniformRand<RealType>::template StandardVariate<LAYER_BITS + 1>(randGenerator, B);
+        size_t stairId = B & (LAYERS - 1);
+        bool negative = B & LAYERS;
+        RealType x = U * table.x[stairId]; /// Get horizontal coordinate
+        /// fast acceptance: we are under the upper stair
+        if (U < table.ratio[stairId] || zigguratSlowPath<LAYERS>(stairId, x, randGenerator))
+            return negative ? -x : x;
     } while (++iter <= ProbabilityDistribution<RealType>::MAX_ITER_REJECTION);
     throw std::runtime_error("Normal distribution: sampling failed");
 }
@@ -149,8 +195,41 @@ RealType NormalRand<RealType>::StandardVariate(RandGenerator &randGenerator)
 template < typename RealType >
 void NormalRand<RealType>::Sample(std::vector<RealType> &outputData) const
 {
-    for (RealType & var : outputData)
-        var = this->Variate();
+    /// Ziggurat in blocks: uniforms and layers for the whole block are drawn at once,
+    /// fast acceptance is resolved in a loop without branches (vectorizable),
+    /// and the rare rejected positions are regenerated by scalar sampler
+    static constexpr size_t LAYERS = RANDLIB_ZIGGURAT_LAYERS;
+    static constexpr int LAYER_BITS = (LAYERS == 128) ? 7 : ((LAYERS == 256) ? 8 : 10);
+    static constexpr size_t BLOCK_SIZE = 256;
+    const auto &table = ziggurat<LAYERS>;
+    RealType U[BLOCK_SIZE];
+    unsigned int B[BLOCK_SIZE];
+    bool accepted[BLOCK_SIZE];
+    const RealType location = this->mu, scale = sigma;
+    size_t size = outputData.size();
+    for (size_t start = 0; start < size; start += BLOCK_SIZE) {
+        size_t blockSize = std::min(BLOCK_SIZE, size - start);
+        RealType *output = outputData.data() + start;
+        UniformRand<RealType>::template StandardVariates<LAYER_BITS + 1>(this->localRandGenerator, U, B, blockSize);
+        for (size_t i = 0; i != blockSize; ++i) {
+            size_t stairId = B[i] & (LAYERS - 1);
+            RealType x = U[i] * table.x[stairId];
+            x = (B[i] & LAYERS) ? -x : x;
+            output[i] = location + scale * x;
+            accepted[i] = U[i] < table.ratio[stairId];
+        }
+        for (size_t i = 0; i != blockSize; ++i) {
+            if (accepted[i])
+                continue;
+            size_t stairId = B[i] & (LAYERS - 1);
+            RealType x = U[i] * table.x[stairId];
+            if (zigguratSlowPath<LAYERS>(stairId, x, this->localRandGenerator))
+                x = (B[i] & LAYERS) ? -x : x;
+            else
+                x = StandardVariate<LAYERS>(this->localRandGenerator);
+            output[i] = location + scale * x;
+        }
+    }
 }
 
 template < typename RealType >
@@ -329,3 +408,12 @@ template class NormalRand<float>;
 template class NormalRand<double>;
 template class NormalRand<long double>;
 
+template float NormalRand<float>::StandardVariate<128>(RandGenerator &);
+template float NormalRand<float>::StandardVariate<256>(RandGenerator &);
+template float NormalRand<float>::StandardVariate<1024>(RandGenerator &);
+template double NormalRand<double>::StandardVariate<128>(RandGenerator &);
+template double NormalRand<double>::StandardVariate<256>(RandGenerator &);
+template double NormalRand<double>::StandardVariate<1024>(RandGenerator &);
+template long double NormalRand<long double>::StandardVariate<128>(RandGenerator &);
+template long double NormalRand<long double>::StandardVariate<256>(RandGenerator &);
+template long double NormalRand<long double>::StandardVariate<1024>(RandGenerator &);
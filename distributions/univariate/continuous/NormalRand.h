@@ -9,27 +9,27 @@
  * @brief The NormalZiggurat class
  * Class for ziggurat making
  * (for normally distributed random data generation)
+ * @tparam LAYERS amount of layers: 128, 256 or 1024
  */
+template < size_t LAYERS >
 class RANDLIBSHARED_EXPORT NormalZiggurat {
+    static_assert(LAYERS == 128 || LAYERS == 256 || LAYERS == 1024, "Ziggurat should have 128, 256 or 1024 layers");
 
-    static constexpr size_t TABLE_SIZE = 257;
-    static constexpr std::array<LongDoublePair, TABLE_SIZE> createZiggurat()
+    /// start of the tail
+    static constexpr long double R = (LAYERS == 128) ? 3.44261985589665212102l :
+                                     (LAYERS == 256) ? 3.65415288536100877140l : 4.03884984610950452215l;
+    /// area under each layer
+    static constexpr long double V = (LAYERS == 128) ? 9.91256303533646107665e-3l :
+                                     (LAYERS == 256) ? 4.92867323397465534446e-3l : 1.22632464635308807421e-3l;
+
+    template < typename T >
+    static constexpr RandMath::ZigguratTable<T, LAYERS> createZiggurat()
     {
-        constexpr long double A = 4.92867323399e-3l; /// area under rectangle
-        std::array<LongDoublePair, TABLE_SIZE> table{};
-        /// coordinates of the implicit rectangle in base layer
-        table[0].first = 0.001260285930498597l; /// exp(-x1);
-        table[0].second = 3.9107579595370918075l; /// A / stairHeight[0];
-        /// implicit value for the top layer
-        table[TABLE_SIZE - 1].second = 0.0l;
-        table[1].second = 3.6541528853610088l;
-        table[1].first = 0.002609072746106362l;
-        for (size_t i = 2; i < TABLE_SIZE - 1; ++i) {
-            /// such y_i that f(x_{i+1}) = y_i
-            table[i].second = std::sqrt(-2 * std::log(table[i - 1].first));
-            table[i].first = table[i - 1].first + A / table[i].second;
-        }
-        return table;
+        return RandMath::createZiggurat<T, LAYERS>(R, V, [] (long double x) {
+            return std::exp(-0.5l * x * x);
+        }, [] (long double y) {
+            return std::sqrt(-2 * std::log(y));
+        });
     }
 
     template < typename RealType >
@@ -53,7 +53,10 @@ class RANDLIBSHARED_EXPORT NormalRand : public StableDistribution<RealType>,
 {
     double sigma = 1; ///< scale σ
 
-    static constexpr auto ziggurat = NormalZiggurat::createZiggurat();
+    /// tables are stored in float for float variates and in double otherwise
+    using ZigguratType = typename std::conditional<std::is_same<RealType, float>::value, float, double>::type;
+    template < size_t LAYERS >
+    static constexpr RandMath::ZigguratTable<ZigguratType, LAYERS> ziggurat = NormalZiggurat<LAYERS>::template createZiggurat<ZigguratType>();
 
 public:
     NormalRand(double location = 0, double variance = 1);
@@ -90,12 +93,37 @@ public:
     double F(const RealType & x) const override;
     double S(const RealType & x) const override;
     RealType Variate() const override;
+    /**
+     * @fn StandardVariate
+     * @tparam LAYERS amount of layers in ziggurat: 128, 256 or 1024
+     * @param randGenerator
+     * @return standard normal variate
+     */
+    template < size_t LAYERS = RANDLIB_ZIGGURAT_LAYERS >
     static RealType StandardVariate(RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
     void Sample(std::vector<RealType> &outputData) const override;
 
 private:
+    /**
+     * @fn zigguratSlowPath
+     * handles the base layer and the wedges of ziggurat
+     * for the point, which wasn't accepted by the fast test
+     * @param stairId layer
+     * @param x horizontal coordinate in input, absolute value of variate in output
+     * @param randGenerator
+     * @return true if point is accepted
+     */
+    template < size_t LAYERS >
+    static bool zigguratSlowPath(size_t stairId, RealType &x, RandGenerator &randGenerator);
+
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
+
+    void pdfBatch(const RealType *x, double *y, size_t n) const override;
+    void logpdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfComplBatch(const RealType *x, double *y, size_t n) const override;
 
     std::complex<double> CFImpl(double t) const override;
 
@@ -110,7 +110,10 @@ void ParetoRand<RealType>::Sample(std::vector<RealType> &outputData) const
     }
     else {
         for (RealType &var : outputData)
-            var = sigma * variateForGeneralAlpha(alpha, this->localRandGenerator);
+            var = ExponentialRand<RealType>::StandardVariate(this->localRandGenerator) / alpha;
+        RandMath::vexp(outputData.data(), outputData.data(), outputData.size());
+        for (RealType &var : outputData)
+            var *= sigma;
     }
 }
 
@@ -35,6 +35,7 @@ public:
 private:
     RealType quantileImpl(double p) const;
     RealType quantileImpl1m(double p) const;
+    bool canWarmStartQuantile() const override { return false; }
 
     std::complex<double> CFImpl(double t) const override;
 public:
@@ -266,8 +266,10 @@ double StableDistribution<RealType>::pdfForUnityExponent(double x) const
 
     /// Find peak of the integrand
     double theta0 = 0;
-    std::function<double (double)> funPtr = std::bind(&StableDistribution<RealType>::integrandAuxForUnityExponent, this, std::placeholders::_1, xAdj);
-    RandMath::findRootNewtonFirstOrder(funPtr, lowerBoundary, upperBoundary, theta0);
+    RandMath::findRootNewtonFirstOrder([this, xAdj] (double theta)
+    {
+        return integrandAuxForUnityExponent(theta, xAdj);
+    }, lowerBoundary, upperBoundary, theta0);
 
     /// Sanity check
     /// if we failed to find the peak position
@@ -275,18 +277,12 @@ double StableDistribution<RealType>::pdfForUnityExponent(double x) const
     if (theta0 >= upperBoundary || theta0 <= lowerBoundary)
         theta0 = 0.5 * (upperBoundary + lowerBoundary);
 
-    std::function<double (double)> integrandPtr = std::bind(&StableDistribution<RealType>::integrandForUnityExponent, this, std::placeholders::_1, xAdj);
-
-    /// If theta0 is too close to +/-π/2, we can still underestimate the value of integral
-    int maxRecursionDepth = 11;
-    double closeness = M_PI_2 - std::fabs(theta0);
-    if (closeness < 0.1)
-        maxRecursionDepth = 20;
-    else if (closeness < 0.2)
-        maxRecursionDepth = 15;
-
-    double int1 = RandMath::integral(integrandPtr, lowerBoundary, theta0, 1e-11, maxRecursionDepth);
-    double int2 = RandMath::integral(integrandPtr, theta0, upperBoundary, 1e-11, maxRecursionDepth);
+    /// Peak of the integrand is at the boundary of both intervals, where nodes of tanh-sinh quadrature
+    /// are dense, hence it is resolved even if theta0 is close to +/-π/2
+    auto integrand = [this, xAdj] (double theta) { return integrandForUnityExponent(theta, xAdj); };
+    double error = 0.0;
+    double int1 = RandMath::doubleExponentialIntegral(integrand, lowerBoundary, theta0, error);
+    double int2 = RandMath::doubleExponentialIntegral(integrand, theta0, upperBoundary, error);
     return pdfCoef * (int1 + int2);
 }
 
@@ -531,21 +527,17 @@ double StableDistribution<RealType>::pdfForGeneralExponent(double x) const
 
     /// Search for the peak of the integrand
     double theta0 = 0;
-    std::function<double (double)> funPtr = std::bind(&StableDistribution<RealType>::integrandAuxForGeneralExponent, this, std::placeholders::_1, xAdj, xiAdj);
-    RandMath::findRootNewtonFirstOrder(funPtr, -xiAdj, M_PI_2, theta0);
-
-    /// If theta0 is too close to π/2 or -xiAdj then we can still underestimate the integral
-    int maxRecursionDepth = 11;
-    double closeness = std::min(M_PI_2 - theta0, theta0 + xiAdj);
-    if (closeness < 0.1)
-        maxRecursionDepth = 20;
-    else if (closeness < 0.2)
-        maxRecursionDepth = 15;
-
-    /// Calculate sum of two integrals
-    std::function<double (double)> integrandPtr = std::bind(&StableDistribution<RealType>::integrandFoGeneralExponent, this, std::placeholders::_1, xAdj, xiAdj);
-    double int1 = RandMath::integral(integrandPtr, -xiAdj, theta0, 1e-11, maxRecursionDepth);
-    double int2 = RandMath::integral(integrandPtr, theta0, M_PI_2, 1e-11, maxRecursionDepth);
+    RandMath::findRootNewtonFirstOrder([this, xAdj, xiAdj] (double theta)
+    {
+        return integrandAuxForGeneralExponent(theta, xAdj, xiAdj);
+    }, -xiAdj, M_PI_2, theta0);
+
+    /// Calculate sum of two integrals. Peak of the integrand is at their common boundary,
+    /// where nodes of tanh-sinh quadrature are dense, hence it is resolved even if theta0 is close to π/2 or -xiAdj
+    auto integrand = [this, xAdj, xiAdj] (double theta) { return integrandFoGeneralExponent(theta, xAdj, xiAdj); };
+    double error = 0.0;
+    double int1 = RandMath::doubleExponentialIntegral(integrand, -xiAdj, theta0, error);
+    double int2 = RandMath::doubleExponentialIntegral(integrand, theta0, M_PI_2, error);
     double res = pdfCoef * (int1 + int2) / absXSt;
 
     /// Finally we check if α is not too close to 2
@@ -678,12 +670,30 @@ double StableDistribution<RealType>::cdfForUnityExponent(double x) const
 {
     double xSt = (x - mu) / gamma;
     double xAdj = -M_PI_2 * xSt / beta - logGammaPi_2;
-    double y = M_1_PI * RandMath::integral([this, xAdj] (double theta)
+
+    /// Integrand is zero where the auxiliary function is above 5, hence we squeeze boundaries as for the density
+    double boundary = RandMath::atan(M_2_PI * beta * (5.0 - xAdj));
+    double upperBoundary = (beta > 0.0) ? boundary : M_PI_2;
+    double lowerBoundary = (beta < 0.0) ? boundary : -M_PI_2;
+
+    /// Find the point, where integrand falls from 1 to 0
+    double theta0 = 0;
+    RandMath::findRootNewtonFirstOrder([this, xAdj] (double theta)
+    {
+        return integrandAuxForUnityExponent(theta, xAdj);
+    }, lowerBoundary, upperBoundary, theta0);
+    if (theta0 >= upperBoundary || theta0 <= lowerBoundary)
+        theta0 = 0.5 * (upperBoundary + lowerBoundary);
+
+    auto integrand = [this, xAdj] (double theta)
     {
         double u = integrandAuxForUnityExponent(theta, xAdj);
         return fastcdfExponentiation(u);
-    },
-    -M_PI_2, M_PI_2);
+    };
+    double error = 0.0;
+    double int1 = RandMath::doubleExponentialIntegral(integrand, lowerBoundary, theta0, error);
+    double int2 = RandMath::doubleExponentialIntegral(integrand, theta0, upperBoundary, error);
+    double y = M_1_PI * (int1 + int2);
     return (beta > 0) ? y : 1.0 - y;
 }
 
@@ -743,12 +753,27 @@ template < typename RealType >
 double StableDistribution<RealType>::cdfIntegralRepresentation(double logX, double xiAdj) const
 {
     double xAdj = alpha_alpham1 * logX;
-    return M_1_PI * RandMath::integral([this, xAdj, xiAdj] (double theta)
+
+    /// Find the point, where integrand falls from 1 to 0 (or rises from 0 to 1).
+    /// If the transition is close to a boundary, the mass of the integrand is concentrated there,
+    /// hence we split the interval at this point and use tanh-sinh quadrature on both parts
+    double theta0 = 0;
+    RandMath::findRootNewtonFirstOrder([this, xAdj, xiAdj] (double theta)
+    {
+        return integrandAuxForGeneralExponent(theta, xAdj, xiAdj);
+    }, -xiAdj, M_PI_2, theta0);
+    if (theta0 >= M_PI_2 || theta0 <= -xiAdj)
+        theta0 = 0.5 * (M_PI_2 - xiAdj);
+
+    auto integrand = [this, xAdj, xiAdj] (double theta)
     {
         double u = integrandAuxForGeneralExponent(theta, xAdj, xiAdj);
         return fastcdfExponentiation(u);
-    },
-    -xiAdj, M_PI_2);
+    };
+    double error = 0.0;
+    double int1 = RandMath::doubleExponentialIntegral(integrand, -xiAdj, theta0, error);
+    double int2 = RandMath::doubleExponentialIntegral(integrand, theta0, M_PI_2, error);
+    return M_1_PI * (int1 + int2);
 }
 
 template < typename RealType >
@@ -1041,6 +1066,12 @@ RealType StableDistribution<RealType>::quantileImpl1m(double p) const
     }
 }
 
+template < typename RealType >
+bool StableDistribution<RealType>::canWarmStartQuantile() const
+{
+    return distributionType != NORMAL && distributionType != CAUCHY && distributionType != LEVY;
+}
+
 template < typename RealType >
 std::complex<double> StableDistribution<RealType>::cfNormal(double t) const
 {
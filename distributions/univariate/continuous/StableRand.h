@@ -404,6 +404,7 @@ protected:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override;
 
 protected:
     /**
@@ -169,6 +169,13 @@ void StudentTRand<RealType>::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+template < typename RealType >
+void StudentTRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    Y.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double StudentTRand<RealType>::Mean() const
 {
@@ -233,6 +240,12 @@ RealType StudentTRand<RealType>::quantileImpl1m(double p) const
     return ContinuousDistribution<RealType>::quantileImpl1m(p);
 }
 
+template < typename RealType >
+bool StudentTRand<RealType>::canWarmStartQuantile() const
+{
+    return nu != 1 && nu != 2 && nu != 4;
+}
+
 template < typename RealType >
 RealType StudentTRand<RealType>::Median() const
 {
@@ -41,6 +41,42 @@ double UniformRand<RealType>::S(const RealType & x) const
     return (x > this->b) ? 0.0 : this->bmaInv * (this->b - x);
 }
 
+template < typename RealType >
+void UniformRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double lower = this->a, upper = this->b, density = this->bmaInv;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] < lower || x[i] > upper) ? 0.0 : density;
+}
+
+template < typename RealType >
+void UniformRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double lower = this->a, upper = this->b, logDensity = -this->logbma;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] < lower || x[i] > upper) ? -INFINITY : logDensity;
+}
+
+template < typename RealType >
+void UniformRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double lower = this->a, upper = this->b, density = this->bmaInv;
+    for (size_t i = 0; i != n; ++i) {
+        double z = density * (x[i] - lower);
+        y[i] = (x[i] < lower) ? 0.0 : ((x[i] > upper) ? 1.0 : z);
+    }
+}
+
+template < typename RealType >
+void UniformRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double lower = this->a, upper = this->b, density = this->bmaInv;
+    for (size_t i = 0; i != n; ++i) {
+        double z = density * (upper - x[i]);
+        y[i] = (x[i] < lower) ? 1.0 : ((x[i] > upper) ? 0.0 : z);
+    }
+}
+
 template < typename RealType >
 RealType UniformRand<RealType>::Variate() const
 {
@@ -50,48 +86,38 @@ RealType UniformRand<RealType>::Variate() const
 template < typename RealType >
 RealType UniformRand<RealType>::StandardVariate(RandGenerator &randGenerator)
 {
-#ifdef RANDLIB_UNIDBL
-    /// generates this->a random number on [0,1) with 53-bit resolution, using 2 32-bit integer variate
-    double x;
-    unsigned int a, b;
-    this->a = randGenerator.Variate() >> 6; /// Upper 26 bits
-    b = randGenerator.Variate() >> 5; /// Upper 27 bits
-    x = (this->a * 134217728.0 + this->b) / 9007199254740992.0;
-    return x;
-#elif defined(RANDLIB_JLKISS64)
-    /// generates this->a random number on [0,1) with 53-bit resolution, using 64-bit integer variate
-    double x;
-    unsigned long long this->a = randGenerator.Variate();
-    this->a = (this->a >> 12) | 0x3FF0000000000000ULL; /// Take upper 52 bit
-    *(reinterpret_cast<unsigned long long *>(&x)) = a; /// Make this->a double from bits
-    return x - 1.0;
-#else
-    RealType x = randGenerator.Variate();
-    x += 0.5;
-    x /= 4294967296.0;
-    return x;
-#endif
+    return openUnitVariate(randomBits<UNIFORM_BITS - 1>(randGenerator));
 }
 
 template < typename RealType >
 RealType UniformRand<RealType>::StandardVariateClosed(RandGenerator &randGenerator)
 {
-    RealType x = randGenerator.Variate();
-    return x / 4294967295.0;
+    static constexpr RealType SCALE = 1.0 / ((1ULL << UNIFORM_BITS) - 1);
+    return randomBits<UNIFORM_BITS>(randGenerator) * SCALE;
 }
 
 template < typename RealType >
 RealType UniformRand<RealType>::StandardVariateHalfClosed(RandGenerator &randGenerator)
 {
-    RealType x = randGenerator.Variate();
-    return x / 4294967296.0;
+    static constexpr RealType SCALE = 1.0 / (1ULL << UNIFORM_BITS);
+    return randomBits<UNIFORM_BITS>(randGenerator) * SCALE;
 }
 
 template < typename RealType >
 void UniformRand<RealType>::Sample(std::vector<RealType> &outputData) const
 {
-    for (RealType & var : outputData)
-        var = this->Variate();
+    /// generate raw words in blocks and convert them in a loop without branches
+    static constexpr size_t BLOCK_SIZE = 256;
+    unsigned long long words[BLOCK_SIZE * WORDS_PER_VARIATE];
+    const double minValue = this->a, width = this->bma;
+    size_t size = outputData.size();
+    for (size_t start = 0; start < size; start += BLOCK_SIZE) {
+        size_t blockSize = std::min(BLOCK_SIZE, size - start);
+        this->localRandGenerator.Fill(words, blockSize * WORDS_PER_VARIATE);
+        RealType *output = outputData.data() + start;
+        for (size_t i = 0; i != blockSize; ++i)
+            output[i] = minValue + openUnitVariate(randomBits<UNIFORM_BITS - 1>(words + i * WORDS_PER_VARIATE)) * width;
+    }
 }
 
 template < typename RealType >
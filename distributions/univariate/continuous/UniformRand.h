@@ -3,6 +3,7 @@
 
 #include "BetaRand.h"
 #include "ParetoRand.h"
+#include <limits>
 
 /**
  * @brief The UniformRand class <BR>
@@ -19,6 +20,53 @@
 template < typename RealType = double >
 class RANDLIBSHARED_EXPORT UniformRand : public BetaDistribution<RealType>
 {
+    /// resolution of standard variates: 24 bits for float, 53 bits otherwise
+    static constexpr int UNIFORM_BITS = std::min(std::numeric_limits<RealType>::digits, 53);
+    /// amount of bits in the words of the generator
+    static constexpr int ENGINE_BITS = (RandGenerator::MaxValue() >> 32) ? 64 : 32;
+    /// amount of words of the generator per standard variate
+    static constexpr size_t WORDS_PER_VARIATE = (UNIFORM_BITS > ENGINE_BITS) ? 2 : 1;
+
+    /**
+     * @fn randomBits
+     * @param words WORDS_PER_VARIATE raw variates of the generator
+     * @return random integer on [0, 2^BITS), taken from the upper bits of given words
+     */
+    template < int BITS >
+    static inline unsigned long long randomBits(const unsigned long long *words)
+    {
+        if constexpr (BITS <= ENGINE_BITS)
+            return words[0] >> (ENGINE_BITS - BITS);
+        else
+            return ((words[0] >> (64 - BITS)) << 32) | words[1];
+    }
+
+    /**
+     * @fn randomBits
+     * @param randGenerator
+     * @return random integer on [0, 2^BITS)
+     */
+    template < int BITS >
+    static inline unsigned long long randomBits(RandGenerator &randGenerator)
+    {
+        unsigned long long words[WORDS_PER_VARIATE];
+        for (unsigned long long & word : words)
+            word = randGenerator.Variate();
+        return randomBits<BITS>(words);
+    }
+
+    /**
+     * @fn openUnitVariate
+     * @param k random integer on [0, 2^BITS)
+     * @return (2k + 1) / 2^(BITS + 1), which lies in (0, 1)
+     */
+    template < int BITS = UNIFORM_BITS - 1 >
+    static inline RealType openUnitVariate(unsigned long long k)
+    {
+        static constexpr RealType SCALE = 1.0 / (1ULL << BITS);
+        return (static_cast<RealType>(k) + static_cast<RealType>(0.5)) * SCALE;
+    }
+
 public:
     UniformRand(double minValue = 0, double maxValue = 1);
     String Name() const override;
@@ -38,10 +86,57 @@ public:
     /**
      * @fn StandardVariate
      * @param randGenerator
-     * @return a random number on interval (0,1) if no preprocessors are specified
+     * @return a random number on interval (0,1) with 53-bit resolution for double and 24-bit for float
      */
     static RealType StandardVariate(RandGenerator &randGenerator = ProbabilityDistribution<RealType>::staticRandGenerator);
 
+    /**
+     * @fn StandardVariate
+     * @tparam SPARE_BITS
+     * @param randGenerator
+     * @param spareBits SPARE_BITS random bits of the same generator words,
+     * which are independent of the returned value (useful for ziggurat layer and sign)
+     * @return a random number on interval (0,1), resolution might be lowered
+     * if the words don't have enough bits for both
+     */
+    template < int SPARE_BITS = 9 >
+    static inline RealType StandardVariate(RandGenerator &randGenerator, unsigned int &spareBits)
+    {
+        static constexpr int BITS = std::min<int>(UNIFORM_BITS - 1, ENGINE_BITS * WORDS_PER_VARIATE - SPARE_BITS);
+        unsigned long long words[WORDS_PER_VARIATE];
+        for (unsigned long long & word : words)
+            word = randGenerator.Variate();
+        /// variate is taken from the upper bits, so the lowest bits of the first word are free
+        spareBits = words[0] & ((1u << SPARE_BITS) - 1);
+        return openUnitVariate<BITS>(randomBits<BITS>(words));
+    }
+
+    /**
+     * @fn StandardVariates
+     * fills arrays with n variates of StandardVariate(randGenerator, spareBits)
+     * @tparam SPARE_BITS
+     * @param randGenerator
+     * @param output array of n random numbers on interval (0,1)
+     * @param spareBits array of n spare bits
+     * @param n
+     */
+    template < int SPARE_BITS = 9 >
+    static void StandardVariates(RandGenerator &randGenerator, RealType *output, unsigned int *spareBits, size_t n)
+    {
+        static constexpr int BITS = std::min<int>(UNIFORM_BITS - 1, ENGINE_BITS * WORDS_PER_VARIATE - SPARE_BITS);
+        static constexpr size_t BLOCK_SIZE = 256;
+        unsigned long long words[BLOCK_SIZE * WORDS_PER_VARIATE];
+        for (size_t start = 0; start < n; start += BLOCK_SIZE) {
+            size_t blockSize = std::min(BLOCK_SIZE, n - start);
+            randGenerator.Fill(words, blockSize * WORDS_PER_VARIATE);
+            for (size_t i = 0; i != blockSize; ++i) {
+                const unsigned long long *variateWords = words + i * WORDS_PER_VARIATE;
+                spareBits[start + i] = variateWords[0] & ((1u << SPARE_BITS) - 1);
+                output[start + i] = openUnitVariate<BITS>(randomBits<BITS>(variateWords));
+            }
+        }
+    }
+
     /**
      * @fn StandardVariateClosed
      * @param randGenerator
@@ -68,6 +163,12 @@ public:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
+
+    void pdfBatch(const RealType *x, double *y, size_t n) const override;
+    void logpdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfComplBatch(const RealType *x, double *y, size_t n) const override;
 
     std::complex<double> CFImpl(double t) const override;
 
@@ -66,12 +66,82 @@ double WeibullRand<RealType>::S(const RealType & x) const
     return (x > 0.0) ? std::exp(-std::pow(x / lambda, k)) : 1.0;
 }
 
+template < typename RealType >
+void WeibullRand<RealType>::pdfBatch(const RealType *x, double *y, size_t n) const
+{
+    logpdfBatch(x, y, n);
+    RandMath::vexp(y, y, n);
+}
+
+template < typename RealType >
+void WeibullRand<RealType>::logpdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape = k, scale = lambda, coef = logk_lambda;
+    const double atZero = (shape == 1) ? coef : ((shape > 1) ? -INFINITY : INFINITY);
+    double logXAdj[RandMath::VECTOR_MATH_BUFFER_SIZE], powXAdj[RandMath::VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += RandMath::VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(RandMath::VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            logXAdj[i] = (x[start + i] > 0) ? x[start + i] / scale : 1.0;
+        /// (x/λ)^k is taken as exp(k * log(x/λ)), since the logarithm is needed anyway
+        RandMath::vlog(logXAdj, logXAdj, size);
+        for (size_t i = 0; i != size; ++i)
+            powXAdj[i] = shape * logXAdj[i];
+        RandMath::vexp(powXAdj, powXAdj, size);
+        for (size_t i = 0; i != size; ++i) {
+            if (x[start + i] > 0)
+                y[start + i] = coef + (shape - 1) * logXAdj[i] - powXAdj[i];
+            else if (x[start + i] < 0)
+                y[start + i] = -INFINITY;
+            else /// zero or NaN, which is propagated as in logf
+                y[start + i] = (x[start + i] == 0) ? atZero : x[start + i];
+        }
+    }
+}
+
+template < typename RealType >
+void WeibullRand<RealType>::cdfBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape = k, scale = lambda;
+    /// zero for x <= 0 turns into zero of the result
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] > 0.0) ? x[i] / scale : 0.0;
+    RandMath::vpow(y, shape, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -y[i];
+    RandMath::vexpm1(y, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -y[i];
+}
+
+template < typename RealType >
+void WeibullRand<RealType>::cdfComplBatch(const RealType *x, double *y, size_t n) const
+{
+    const double shape = k, scale = lambda;
+    for (size_t i = 0; i != n; ++i)
+        y[i] = (x[i] > 0.0) ? x[i] / scale : 0.0;
+    RandMath::vpow(y, shape, y, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] = -y[i];
+    RandMath::vexp(y, y, n);
+}
+
 template < typename RealType >
 RealType WeibullRand<RealType>::Variate() const
 {
     return lambda * std::pow(ExponentialRand<RealType>::StandardVariate(this->localRandGenerator), kInv);
 }
 
+template < typename RealType >
+void WeibullRand<RealType>::Sample(std::vector<RealType> &outputData) const
+{
+    for (RealType &var : outputData)
+        var = ExponentialRand<RealType>::StandardVariate(this->localRandGenerator);
+    RandMath::vpow(outputData.data(), static_cast<RealType>(kInv), outputData.data(), outputData.size());
+    for (RealType &var : outputData)
+        var *= lambda;
+}
+
 template < typename RealType >
 long double WeibullRand<RealType>::Mean() const
 {
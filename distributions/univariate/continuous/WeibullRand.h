@@ -35,6 +35,7 @@ public:
     double F(const RealType & x) const override;
     double S(const RealType & x) const override;
     RealType Variate() const override;
+    void Sample(std::vector<RealType> &outputData) const override;
 
     long double Mean() const override;
     long double Variance() const override;
@@ -46,6 +47,12 @@ public:
 private:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
+
+    void pdfBatch(const RealType *x, double *y, size_t n) const override;
+    void logpdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfBatch(const RealType *x, double *y, size_t n) const override;
+    void cdfComplBatch(const RealType *x, double *y, size_t n) const override;
 
     std::complex<double> CFImpl(double t) const override;
 
@@ -70,6 +70,12 @@ void WignerSemicircleRand<RealType>::Reseed(unsigned long seed) const
     X.Reseed(seed);
 }
 
+template < typename RealType >
+void WignerSemicircleRand<RealType>::Discard(unsigned long long variatesNum) const
+{
+    X.Discard(variatesNum);
+}
+
 template < typename RealType >
 long double WignerSemicircleRand<RealType>::Mean() const
 {
@@ -37,6 +37,7 @@ public:
     double F(const RealType & x) const override;
     RealType Variate() const override;
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
@@ -39,6 +39,7 @@ public:
 protected:
     RealType quantileImpl(double p) const override;
     RealType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
     std::complex<double> CFImpl(double t) const override;
 };
 
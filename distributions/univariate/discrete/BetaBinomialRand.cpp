@@ -102,6 +102,13 @@ void BetaBinomialRand<IntType>::Reseed(unsigned long seed) const
     B.Reseed(seed + 1);
 }
 
+template< typename IntType >
+void BetaBinomialRand<IntType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    B.Discard(variatesNum);
+}
+
 template< typename IntType >
 long double BetaBinomialRand<IntType>::Mean() const
 {
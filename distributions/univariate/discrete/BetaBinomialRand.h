@@ -46,6 +46,7 @@ public:
     void Sample(std::vector<IntType> &outputData) const override;
 
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
@@ -339,6 +339,51 @@ IntType BinomialDistribution<IntType>::Variate() const
     }
 }
 
+template< typename IntType >
+typename BinomialDistribution<IntType>::TransformedRejectionConstants BinomialDistribution<IntType>::transformedRejectionConstants(IntType number, double probability)
+{
+    TransformedRejectionConstants constants;
+    double q = 1.0 - probability;
+    double sigma = std::sqrt(number * probability * q);
+    constants.number = number;
+    constants.b = 1.15 + 2.53 * sigma;
+    constants.a = -0.0873 + 0.0248 * constants.b + 0.01 * probability;
+    constants.c = number * probability + 0.5;
+    constants.vr = 0.92 - 4.2 / constants.b;
+    constants.logAlpha = std::log((2.83 + 5.1 / constants.b) * sigma);
+    constants.logOdds = std::log(probability / q);
+    constants.mode = std::floor((number + 1) * probability);
+    constants.logPMode = RandMath::lfact(constants.mode) + RandMath::lfact(number - constants.mode);
+    return constants;
+}
+
+template< typename IntType >
+IntType BinomialDistribution<IntType>::variateTransformedRejection(const TransformedRejectionConstants &constants, RandGenerator &randGenerator)
+{
+    /// BTRS algorithm: W. Hörmann, "The generation of binomial random variates", 1993
+    /// it can be used only when p <= 0.5 and n * p >= 10
+    const double a = constants.a, b = constants.b, n = constants.number;
+    size_t iter = 0;
+    do {
+        double U = UniformRand<double>::StandardVariate(randGenerator) - 0.5;
+        double V = UniformRand<double>::StandardVariate(randGenerator);
+        double us = 0.5 - std::fabs(U);
+        double X = std::floor((2 * a / us + b) * U + constants.c);
+        /// squeeze acceptance
+        if (us >= 0.07 && V <= constants.vr)
+            return X;
+        if (X < 0 || X > n)
+            continue;
+        double logAcceptance = std::log(V) + constants.logAlpha - std::log(a / (us * us) + b);
+        /// log(P(X) / P(mode))
+        double logRatio = constants.logPMode - RandMath::lfact(X) - RandMath::lfact(n - X);
+        logRatio += (X - constants.mode) * constants.logOdds;
+        if (logAcceptance <= logRatio)
+            return X;
+    } while (++iter <= ProbabilityDistribution<IntType>::MAX_ITER_REJECTION);
+    throw std::runtime_error("Binomial distribution: sampling failed");
+}
+
 template< typename IntType >
 IntType BinomialDistribution<IntType>::Variate(IntType number, double probability, RandGenerator &randGenerator)
 {
@@ -356,9 +401,73 @@ IntType BinomialDistribution<IntType>::Variate(IntType number, double probabilit
 
     if (number < 10)
         return variateBernoulliSum(number, probability, randGenerator);
-    if (probability < 0.5)
-        return variateWaiting(number, probability, randGenerator);
-    return number - variateWaiting(number, 1.0 - probability, randGenerator);
+    double minpq = std::min(probability, 1.0 - probability);
+    IntType X = (number * minpq < 10) ? variateWaiting(number, minpq, randGenerator)
+                                      : variateTransformedRejection(transformedRejectionConstants(number, minpq), randGenerator);
+    return (probability < 0.5) ? X : number - X;
+}
+
+template< typename IntType >
+void BinomialDistribution<IntType>::Variates(const std::vector<IntType> &numbers, const std::vector<double> &probabilities, std::vector<IntType> &outputData, RandGenerator &randGenerator)
+{
+    if (numbers.size() != probabilities.size())
+        throw std::invalid_argument("Binomial distribution: sizes of numbers and probabilities should coincide");
+    for (size_t i = 0; i != numbers.size(); ++i) {
+        if (numbers[i] < 0)
+            throw std::invalid_argument("Binomial distribution: number should be positive, but it's equal to "
+                                        + std::to_string(numbers[i]));
+        if (!(probabilities[i] >= 0.0 && probabilities[i] <= 1.0))
+            throw std::invalid_argument("Binomial distribution: probability parameter should in interval [0, 1], but it's equal to "
+                                        + std::to_string(probabilities[i]));
+    }
+    outputData.resize(numbers.size());
+
+    /// elements are processed in blocks, which fit into cache:
+    /// indices are grouped by used generator, the degenerate cases are resolved immediately
+    static constexpr size_t BLOCK_SIZE = 256;
+    size_t bernoulliSum[BLOCK_SIZE], waiting[BLOCK_SIZE], rejection[BLOCK_SIZE];
+    TransformedRejectionConstants constants[BLOCK_SIZE];
+    for (size_t start = 0; start < numbers.size(); start += BLOCK_SIZE) {
+        size_t end = std::min(start + BLOCK_SIZE, numbers.size());
+        size_t bernoulliSumSize = 0, waitingSize = 0, rejectionSize = 0;
+        for (size_t i = start; i != end; ++i) {
+            double probability = probabilities[i];
+            IntType number = numbers[i];
+            if (probability == 0.0 || number == 0)
+                outputData[i] = 0;
+            else if (probability == 1.0)
+                outputData[i] = number;
+            else if (number < 10)
+                bernoulliSum[bernoulliSumSize++] = i;
+            else if (number * std::min(probability, 1.0 - probability) < 10)
+                waiting[waitingSize++] = i;
+            else
+                rejection[rejectionSize++] = i;
+        }
+
+        for (size_t j = 0; j != bernoulliSumSize; ++j) {
+            size_t i = bernoulliSum[j];
+            outputData[i] = variateBernoulliSum(numbers[i], probabilities[i], randGenerator);
+        }
+
+        for (size_t j = 0; j != waitingSize; ++j) {
+            size_t i = waiting[j];
+            double probability = probabilities[i];
+            IntType X = variateWaiting(numbers[i], std::min(probability, 1.0 - probability), randGenerator);
+            outputData[i] = (probability < 0.5) ? X : numbers[i] - X;
+        }
+
+        /// setup of rejection is computed in a separate loop
+        for (size_t j = 0; j != rejectionSize; ++j) {
+            double probability = probabilities[rejection[j]];
+            constants[j] = transformedRejectionConstants(numbers[rejection[j]], std::min(probability, 1.0 - probability));
+        }
+        for (size_t j = 0; j != rejectionSize; ++j) {
+            size_t i = rejection[j];
+            IntType X = variateTransformedRejection(constants[j], randGenerator);
+            outputData[i] = (probabilities[i] < 0.5) ? X : numbers[i] - X;
+        }
+    }
 }
 
 template< typename IntType >
@@ -418,6 +527,13 @@ void BinomialDistribution<IntType>::Reseed(unsigned long seed) const
     G.Reseed(seed);
 }
 
+template< typename IntType >
+void BinomialDistribution<IntType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    G.Discard(variatesNum);
+}
+
 template< typename IntType >
 long double BinomialDistribution<IntType>::Mean() const
 {
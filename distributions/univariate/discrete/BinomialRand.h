@@ -116,11 +116,45 @@ private:
     static IntType variateWaiting(IntType number, double probability, RandGenerator &randGenerator);
     static IntType variateBernoulliSum(IntType number, double probability, RandGenerator &randGenerator);
 
+    /**
+     * @brief The TransformedRejectionConstants struct
+     * setup of BTRS algorithm, which depends only on n and p
+     */
+    struct TransformedRejectionConstants
+    {
+        double number = 0;
+        double a = 0, b = 0, c = 0;
+        double vr = 0, logAlpha = 0;
+        double logOdds = 0; ///< log(p / q)
+        double mode = 0; ///< [(n + 1) * p]
+        double logPMode = 0; ///< log(mode!) + log((n - mode)!)
+    };
+    static TransformedRejectionConstants transformedRejectionConstants(IntType number, double probability);
+    /**
+     * @fn variateTransformedRejection
+     * BTRS algorithm, exact with bounded expected number of iterations, valid for p <= 0.5 and n * p >= 10
+     * @param constants
+     * @param randGenerator
+     * @return binomial variate
+     */
+    static IntType variateTransformedRejection(const TransformedRejectionConstants &constants, RandGenerator &randGenerator);
+
 public:
     IntType Variate() const override;
     static IntType Variate(IntType number, double probability, RandGenerator &randGenerator = ProbabilityDistribution<IntType>::staticRandGenerator);
+    /**
+     * @fn Variates
+     * one variate per pair of parameters: elements are grouped by used algorithm
+     * and setup constants of each group are computed in a separate loop
+     * @param numbers
+     * @param probabilities
+     * @param outputData
+     * @param randGenerator
+     */
+    static void Variates(const std::vector<IntType> &numbers, const std::vector<double> &probabilities, std::vector<IntType> &outputData, RandGenerator &randGenerator = ProbabilityDistribution<IntType>::staticRandGenerator);
     void Sample(std::vector<IntType> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
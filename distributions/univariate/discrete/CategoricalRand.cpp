@@ -26,6 +26,42 @@ void CategoricalRand<IntType>::SetProbabilities(std::vector<double> &&probabilit
     }
 
     K = prob.size();
+    buildAliasTable();
+}
+
+template < typename IntType >
+void CategoricalRand<IntType>::buildAliasTable()
+{
+    aliasThreshold.assign(K, 1.0);
+    alias.resize(K);
+    std::iota(alias.begin(), alias.end(), 0);
+    /// split columns, scaled to the mean height 1, into deficient and overfull ones
+    std::vector<IntType> small, large;
+    small.reserve(K);
+    large.reserve(K);
+    for (IntType i = 0; i != K; ++i) {
+        aliasThreshold[i] = K * prob[i];
+        if (aliasThreshold[i] < 1.0)
+            small.push_back(i);
+        else
+            large.push_back(i);
+    }
+    /// fill each deficient column with the excess of an overfull one
+    while (!small.empty() && !large.empty()) {
+        IntType less = small.back(), more = large.back();
+        small.pop_back();
+        alias[less] = more;
+        aliasThreshold[more] -= 1.0 - aliasThreshold[less];
+        if (aliasThreshold[more] < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+    /// remaining columns are full up to rounding errors
+    for (IntType i : large)
+        aliasThreshold[i] = 1.0;
+    for (IntType i : small)
+        aliasThreshold[i] = 1.0;
 }
 
 template < typename IntType >
@@ -63,7 +99,14 @@ template < typename IntType >
 IntType CategoricalRand<IntType>::Variate() const
 {
     double U = UniformRand<double>::StandardVariate(this->localRandGenerator);
-    return quantileImpl(U);
+    return aliasVariate(U);
+}
+
+template < typename IntType >
+void CategoricalRand<IntType>::Sample(std::vector<IntType> &outputData) const
+{
+    for (IntType &var : outputData)
+        var = aliasVariate(UniformRand<double>::StandardVariate(this->localRandGenerator));
 }
 
 template < typename IntType >
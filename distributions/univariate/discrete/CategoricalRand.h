@@ -20,6 +20,26 @@ class RANDLIBSHARED_EXPORT CategoricalRand : public DiscreteDistribution<IntType
 {
     std::vector<double> prob{1.0}; ///< vector of probabilities
     IntType K = 1; ///< number of possible outcomes
+    std::vector<double> aliasThreshold{1.0}; ///< probability to keep the column in alias method
+    std::vector<IntType> alias{0}; ///< alternative outcome of the column in alias method
+
+    /**
+     * @fn buildAliasTable
+     * Vose's construction of alias table in O(K)
+     */
+    void buildAliasTable();
+
+    /**
+     * @fn aliasVariate
+     * @param U uniform random variable on [0, 1)
+     * @return outcome of the alias method in O(1)
+     */
+    inline IntType aliasVariate(double U) const
+    {
+        double x = U * K;
+        IntType column = std::min<IntType>(x, K - 1);
+        return (x - column < aliasThreshold[column]) ? column : alias[column];
+    }
 
 public:
     explicit CategoricalRand(std::vector<double>&& probabilities = {1.0});
@@ -35,6 +55,7 @@ public:
     double logP(const IntType & k) const override;
     double F(const IntType & k) const override;
     IntType Variate() const override;
+    void Sample(std::vector<IntType> &outputData) const override;
 
     long double Mean() const override;
     long double Variance() const override;
@@ -43,6 +64,7 @@ public:
 private:
     IntType quantileImpl(double p) const override;
     IntType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
     std::complex<double> CFImpl(double t) const override;
 };
 
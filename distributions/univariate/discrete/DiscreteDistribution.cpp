@@ -1,5 +1,6 @@
 #include "DiscreteDistribution.h"
 #include "../continuous/GammaRand.h"
+#include "../continuous/UniformRand.h"
 
 template < typename IntType >
 void DiscreteDistribution<IntType>::ProbabilityMassFunction(const std::vector<IntType> &x, std::vector<double> &y) const
@@ -39,6 +40,135 @@ IntType DiscreteDistribution<IntType>::Mode() const
     return x;
 }
 
+template < typename IntType >
+typename DiscreteDistribution<IntType>::RatioOfUniformsConstants DiscreteDistribution<IntType>::ratioOfUniformsConstants() const
+{
+    RatioOfUniformsConstants constants;
+    IntType mode = this->Mode();
+    IntType minValue = this->MinValue(), maxValue = this->MaxValue();
+    constants.a = mode + 0.5;
+    constants.lower = minValue;
+    constants.upper = static_cast<double>(maxValue) + 1.0;
+    constants.logPMode = this->logP(mode);
+
+    /// half-width of the hat is the maximum of |x - a| * sqrt(P(X = [x]) / P(X = mode)).
+    /// For log-concave distribution its logarithm is concave on each side of the mode,
+    /// hence the maximum is found by ternary search
+    auto logWidth = [this, &constants] (IntType k, bool right) {
+        double distance = right ? k + 1.0 - constants.a : constants.a - k;
+        return std::log(distance) + 0.5 * (this->logP(k) - constants.logPMode);
+    };
+    auto maxLogWidth = [&logWidth] (IntType lo, IntType hi, bool right) {
+        while (hi - lo > 2) {
+            IntType m1 = lo + (hi - lo) / 3, m2 = hi - (hi - lo) / 3;
+            if (logWidth(m1, right) < logWidth(m2, right))
+                lo = m1 + 1;
+            else
+                hi = m2;
+        }
+        double maxLog = logWidth(lo, right);
+        for (IntType k = lo + 1; k <= hi; ++k)
+            maxLog = std::max(maxLog, logWidth(k, right));
+        return maxLog;
+    };
+    double halfWidth = std::max(maxLogWidth(mode, maxValue, true), maxLogWidth(minValue, mode, false));
+    /// small margin covers rounding errors of logP
+    constants.h = 2.0 * std::exp(halfWidth) * (1.0 + 1e-6);
+    return constants;
+}
+
+template < typename IntType >
+IntType DiscreteDistribution<IntType>::variateRatioOfUniforms(const RatioOfUniformsConstants &constants) const
+{
+    size_t iter = 0;
+    do {
+        double U = UniformRand<double>::StandardVariate(this->localRandGenerator);
+        double V = UniformRand<double>::StandardVariate(this->localRandGenerator);
+        double X = constants.a + constants.h * (V - 0.5) / U;
+        /// fast rejection
+        if (X < constants.lower || X >= constants.upper)
+            continue;
+        IntType k = std::floor(X);
+        double T = this->logP(k) - constants.logPMode;
+        /// fast acceptance
+        if (U * (4.0 - U) - 3.0 <= T)
+            return k;
+        /// fast rejection
+        if (U * (U - T) >= 1.0)
+            continue;
+        if (2.0 * std::log(U) <= T)
+            return k;
+    } while (++iter <= ProbabilityDistribution<IntType>::MAX_ITER_REJECTION);
+    throw std::runtime_error("Discrete distribution: ratio-of-uniforms sampling failed");
+}
+
+template < typename IntType >
+IntType DiscreteDistribution<IntType>::quantileInitialGuess(double p, bool isComplement) const
+{
+    static constexpr IntType MAX_INT = std::numeric_limits<IntType>::max(), MIN_INT = std::numeric_limits<IntType>::min();
+    /// true if x is less than the quantile
+    auto isBelow = [this, p, isComplement] (const IntType & x)
+    {
+        return isComplement ? this->S(x) > p : this->F(x) < p;
+    };
+    SUPPORT_TYPE suppType = this->SupportType();
+    bool isBoundedBelow = (suppType == FINITE_T || suppType == RIGHTSEMIFINITE_T);
+    bool isBoundedAbove = (suppType == FINITE_T || suppType == LEFTSEMIFINITE_T);
+    IntType minValue = isBoundedBelow ? this->MinValue() : MIN_INT;
+    IntType maxValue = isBoundedAbove ? this->MaxValue() : MAX_INT;
+
+    /// start from normal approximation, if moments exist
+    double mean = this->Mean(), var = this->Variance();
+    bool isMeanFinite = std::isfinite(mean), isVarFinite = std::isfinite(var) && var > 0;
+    double x = isMeanFinite ? mean : 0.0;
+    if (isMeanFinite && isVarFinite) {
+        double z = M_SQRT2 * RandMath::erfcinv(2 * p);
+        x += isComplement ? std::sqrt(var) * z : -std::sqrt(var) * z;
+    }
+    x = std::max<double>(minValue, std::min<double>(x, maxValue));
+    IntType start = std::floor(x);
+    IntType step = isVarFinite ? std::max<double>(1.0, std::min<double>(std::sqrt(var), MAX_INT / 4)) : 1;
+
+    /// find such lower and upper that isBelow(lower) is true and isBelow(upper) is false,
+    /// expanding the bracket geometrically
+    IntType lower = start, upper = start;
+    if (isBelow(start)) {
+        while (true) {
+            upper = (lower < maxValue - step) ? lower + step : maxValue;
+            if (upper == maxValue || !isBelow(upper))
+                break;
+            lower = upper;
+            if (step < MAX_INT / 2)
+                step *= 2;
+        }
+    }
+    else {
+        while (true) {
+            if (upper <= minValue + step) {
+                lower = minValue;
+                if (!isBelow(minValue))
+                    return minValue;
+                break;
+            }
+            lower = upper - step;
+            if (isBelow(lower))
+                break;
+            upper = lower;
+            if (step < MAX_INT / 2)
+                step *= 2;
+        }
+    }
+    /// binary search
+    while (upper - lower > 1) {
+        IntType middle = lower + (upper - lower) / 2;
+        if (isBelow(middle))
+            lower = middle;
+        else
+            upper = middle;
+    }
+    return upper;
+}
+
 template < typename IntType >
 IntType DiscreteDistribution<IntType>::quantileImpl(double p, IntType initValue) const
 {
@@ -63,15 +193,7 @@ IntType DiscreteDistribution<IntType>::quantileImpl(double p, IntType initValue)
 template < typename IntType >
 IntType DiscreteDistribution<IntType>::quantileImpl(double p) const
 {
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<IntType> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    if (index == 0)
-        return this->quantileImpl(p, *std::min_element(sample.begin(), sample.end()));
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end());
-    return this->quantileImpl(p, sample[index]);
+    return this->quantileImpl(p, this->quantileInitialGuess(p, false));
 }
 
 template < typename IntType >
@@ -98,15 +220,7 @@ IntType DiscreteDistribution<IntType>::quantileImpl1m(double p, IntType initValu
 template < typename IntType >
 IntType DiscreteDistribution<IntType>::quantileImpl1m(double p) const
 {
-    /// We use quantile from sample as an initial guess
-    static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<IntType> sample(SAMPLE_SIZE);
-    this->Sample(sample);
-    int index = p * SAMPLE_SIZE;
-    if (index == 0)
-        return this->quantileImpl1m(p, *std::max_element(sample.begin(), sample.end()));
-    std::nth_element(sample.begin(), sample.begin() + index, sample.end(), std::greater<>());
-    return this->quantileImpl1m(p, sample[index]);
+    return this->quantileImpl1m(p, this->quantileInitialGuess(p, true));
 }
 
 template < typename IntType >
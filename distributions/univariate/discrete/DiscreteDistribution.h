@@ -50,11 +50,56 @@ public:
 
     IntType Mode() const override;
 
+private:
+    /**
+     * @fn quantileInitialGuess
+     * finds the smallest k such that F(k) >= p (or S(k) <= p if isComplement)
+     * by exponential search, starting from normal approximation
+     * by first two moments, and subsequent binary search.
+     * Neither allocates nor uses shared state, hence safe for concurrent calls
+     * @param p
+     * @param isComplement
+     * @return initial guess for quantile
+     */
+    IntType quantileInitialGuess(double p, bool isComplement) const;
+
 protected:
+    /**
+     * @brief The RatioOfUniformsConstants struct
+     * hat of ratio-of-uniforms method for log-concave distributions
+     */
+    struct RatioOfUniformsConstants
+    {
+        double a = 0.5; ///< mode + 0.5
+        double h = 1; ///< width of the hat
+        double lower = 0; ///< minimal value
+        double upper = 1; ///< maximal value + 1
+        double logPMode = 0; ///< logarithm of probability at the mode
+    };
+
+    /**
+     * @fn ratioOfUniformsConstants
+     * builds the smallest hat, centered at the mode, in O(log(support width)) calls of logP,
+     * valid only for log-concave distributions
+     * @return constants of the hat
+     */
+    RatioOfUniformsConstants ratioOfUniformsConstants() const;
+
+    /**
+     * @fn variateRatioOfUniforms
+     * ratio-of-uniforms method (E. Stadlober, "The ratio of uniforms approach
+     * for generating discrete random variates", 1990) with bounded expected
+     * number of iterations for any log-concave distribution
+     * @param constants
+     * @return random variate
+     */
+    IntType variateRatioOfUniforms(const RatioOfUniformsConstants &constants) const;
+
     IntType quantileImpl(double p, IntType initValue) const override;
     IntType quantileImpl(double p) const override;
     IntType quantileImpl1m(double p, IntType initValue) const override;
     IntType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return true; }
     long double ExpectedValue(const std::function<double (IntType)> &funPtr, IntType minPoint, IntType maxPoint) const override;
 
 public:
@@ -0,0 +1,258 @@
+#include "DynamicCategoricalRand.h"
+#include "../continuous/UniformRand.h"
+
+template < typename IntType >
+DynamicCategoricalRand<IntType>::DynamicCategoricalRand(std::vector<double>&& weights)
+{
+    SetWeights(std::move(weights));
+}
+
+template < typename IntType >
+String DynamicCategoricalRand<IntType>::Name() const
+{
+    String str = "Dynamic Categorical(";
+    for (IntType i = 0; i != K - 1; ++i)
+        str += this->toStringWithPrecision(P(i)) + ", ";
+    return str + this->toStringWithPrecision(P(K - 1)) + ")";
+}
+
+template < typename IntType >
+void DynamicCategoricalRand<IntType>::updateAncestors(size_t leaf)
+{
+    for (size_t i = leaf >> 1; i != 0; i >>= 1)
+        tree[i] = tree[2 * i] + tree[2 * i + 1];
+}
+
+template < typename IntType >
+void DynamicCategoricalRand<IntType>::reserve(size_t size)
+{
+    if (size <= capacity)
+        return;
+    size_t newCapacity = capacity;
+    while (newCapacity < size)
+        newCapacity *= 2;
+    std::vector<double> newTree(2 * newCapacity, 0.0);
+    std::copy(tree.begin() + capacity, tree.begin() + capacity + K, newTree.begin() + newCapacity);
+    for (size_t i = newCapacity - 1; i != 0; --i)
+        newTree[i] = newTree[2 * i] + newTree[2 * i + 1];
+    tree = std::move(newTree);
+    capacity = newCapacity;
+}
+
+template < typename IntType >
+void DynamicCategoricalRand<IntType>::SetWeights(std::vector<double> &&weights)
+{
+    if (weights.size() == 0)
+        throw std::invalid_argument("Dynamic Categorical distribution: number of outcomes should be positive");
+    for (double weight : weights) {
+        if (!(weight >= 0.0) || !std::isfinite(weight))
+            throw std::invalid_argument("Dynamic Categorical distribution: weights should be non-negative and finite");
+    }
+    size_t newCapacity = 1;
+    while (newCapacity < weights.size())
+        newCapacity *= 2;
+    std::vector<double> newTree(2 * newCapacity, 0.0);
+    std::copy(weights.begin(), weights.end(), newTree.begin() + newCapacity);
+    for (size_t i = newCapacity - 1; i != 0; --i)
+        newTree[i] = newTree[2 * i] + newTree[2 * i + 1];
+    if (newTree[1] <= 0.0)
+        throw std::invalid_argument("Dynamic Categorical distribution: at least one weight should be positive");
+    tree = std::move(newTree);
+    capacity = newCapacity;
+    K = weights.size();
+}
+
+template < typename IntType >
+void DynamicCategoricalRand<IntType>::SetWeight(IntType k, double weight)
+{
+    if (k < 0 || k >= K)
+        throw std::invalid_argument("Dynamic Categorical distribution: outcome is out of range");
+    if (!(weight >= 0.0) || !std::isfinite(weight))
+        throw std::invalid_argument("Dynamic Categorical distribution: weights should be non-negative and finite");
+    size_t leaf = capacity + k;
+    double oldWeight = tree[leaf];
+    tree[leaf] = weight;
+    updateAncestors(leaf);
+    if (tree[1] <= 0.0) {
+        tree[leaf] = oldWeight;
+        updateAncestors(leaf);
+        throw std::invalid_argument("Dynamic Categorical distribution: at least one weight should be positive");
+    }
+}
+
+template < typename IntType >
+IntType DynamicCategoricalRand<IntType>::AddOutcome(double weight)
+{
+    if (!(weight >= 0.0) || !std::isfinite(weight))
+        throw std::invalid_argument("Dynamic Categorical distribution: weights should be non-negative and finite");
+    reserve(K + 1);
+    size_t leaf = capacity + K;
+    tree[leaf] = weight;
+    updateAncestors(leaf);
+    return K++;
+}
+
+template < typename IntType >
+void DynamicCategoricalRand<IntType>::RemoveOutcome(IntType k)
+{
+    SetWeight(k, 0.0);
+    /// drop trailing outcomes of zero weight, positive total guarantees that one remains
+    while (tree[capacity + K - 1] == 0.0)
+        --K;
+}
+
+template < typename IntType >
+std::vector<double> DynamicCategoricalRand<IntType>::GetProbabilities() const
+{
+    std::vector<double> prob(tree.begin() + capacity, tree.begin() + capacity + K);
+    for (double & p : prob)
+        p /= tree[1];
+    return prob;
+}
+
+template < typename IntType >
+IntType DynamicCategoricalRand<IntType>::findOutcome(double x) const
+{
+    size_t i = 1;
+    while (i < capacity) {
+        double leftWeight = tree[2 * i];
+        /// go right only if the right subtree is not empty, otherwise x exceeds left sum due to rounding
+        if (x < leftWeight || tree[2 * i + 1] == 0.0)
+            i = 2 * i;
+        else {
+            x -= leftWeight;
+            i = 2 * i + 1;
+        }
+    }
+    return i - capacity;
+}
+
+template < typename IntType >
+double DynamicCategoricalRand<IntType>::cumulativeWeight(IntType k) const
+{
+    /// sum of leaves up to k: add left siblings on the path from the leaf to the root
+    size_t i = capacity + k;
+    double sum = tree[i];
+    for (; i > 1; i >>= 1) {
+        if (i & 1)
+            sum += tree[i - 1];
+    }
+    return sum;
+}
+
+template < typename IntType >
+double DynamicCategoricalRand<IntType>::P(const IntType & k) const
+{
+    return (k < 0 || k >= K) ? 0.0 : tree[capacity + k] / tree[1];
+}
+
+template < typename IntType >
+double DynamicCategoricalRand<IntType>::logP(const IntType & k) const
+{
+    return std::log(P(k));
+}
+
+template < typename IntType >
+double DynamicCategoricalRand<IntType>::F(const IntType & k) const
+{
+    if (k < 0)
+        return 0.0;
+    if (k >= K - 1)
+        return 1.0;
+    return std::min(cumulativeWeight(k) / tree[1], 1.0);
+}
+
+template < typename IntType >
+double DynamicCategoricalRand<IntType>::S(const IntType & k) const
+{
+    if (k < 0)
+        return 1.0;
+    if (k >= K - 1)
+        return 0.0;
+    return std::max(1.0 - cumulativeWeight(k) / tree[1], 0.0);
+}
+
+template < typename IntType >
+IntType DynamicCategoricalRand<IntType>::Variate() const
+{
+    return findOutcome(tree[1] * UniformRand<double>::StandardVariate(this->localRandGenerator));
+}
+
+template < typename IntType >
+void DynamicCategoricalRand<IntType>::Sample(std::vector<IntType> &outputData) const
+{
+    const double totalWeight = tree[1];
+    for (IntType &var : outputData)
+        var = findOutcome(totalWeight * UniformRand<double>::StandardVariate(this->localRandGenerator));
+}
+
+template < typename IntType >
+long double DynamicCategoricalRand<IntType>::Mean() const
+{
+    long double sum = 0.0;
+    for (IntType i = 1; i != K; ++i)
+        sum += i * tree[capacity + i];
+    return sum / tree[1];
+}
+
+template < typename IntType >
+long double DynamicCategoricalRand<IntType>::Variance() const
+{
+    long double mean = 0.0, secMom = 0.0;
+    for (IntType i = 1; i != K; ++i) {
+        long double aux = i * tree[capacity + i];
+        mean += aux;
+        secMom += i * aux;
+    }
+    mean /= tree[1];
+    secMom /= tree[1];
+    return secMom - mean * mean;
+}
+
+template < typename IntType >
+IntType DynamicCategoricalRand<IntType>::Mode() const
+{
+    auto firstLeaf = tree.begin() + capacity;
+    return std::distance(firstLeaf, std::max_element(firstLeaf, firstLeaf + K));
+}
+
+template < typename IntType >
+IntType DynamicCategoricalRand<IntType>::quantileImpl(double p) const
+{
+    /// descent gives the answer up to rounding, which is corrected by comparison with F
+    IntType k = findOutcome(p * tree[1]);
+    while (k < K - 1 && F(k) < p)
+        ++k;
+    while (k > 0 && F(k - 1) >= p)
+        --k;
+    return k;
+}
+
+template < typename IntType >
+IntType DynamicCategoricalRand<IntType>::quantileImpl1m(double p) const
+{
+    IntType k = findOutcome((1.0 - p) * tree[1]);
+    while (k < K - 1 && S(k) > p)
+        ++k;
+    while (k > 0 && S(k - 1) <= p)
+        --k;
+    return k;
+}
+
+template < typename IntType >
+std::complex<double> DynamicCategoricalRand<IntType>::CFImpl(double t) const
+{
+    double re = 0.0;
+    double im = 0.0;
+    for (IntType i = 0; i != K; ++i) {
+        double weight = tree[capacity + i];
+        re += weight * std::cos(t * i);
+        im += weight * std::sin(t * i);
+    }
+    return std::complex<double>(re / tree[1], im / tree[1]);
+}
+
+
+template class DynamicCategoricalRand<int>;
+template class DynamicCategoricalRand<long int>;
+template class DynamicCategoricalRand<long long int>;
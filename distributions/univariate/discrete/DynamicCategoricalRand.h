@@ -0,0 +1,117 @@
+#ifndef DYNAMICCATEGORICALRAND_H
+#define DYNAMICCATEGORICALRAND_H
+
+#include "DiscreteDistribution.h"
+
+/**
+ * @brief The DynamicCategoricalRand class <BR>
+ * Categorical distribution with mutable weights
+ *
+ * P(X = k) = w_k / (w_0 + ... + w_{K-1}) for k = {0, ..., K-1}
+ *
+ * Notation: X ~ Cat(w_0, ..., w_{K-1}) with unnormalized weights
+ *
+ * Weights are stored in the leaves of a segment tree, each inner node
+ * holds the sum of its subtree. Therefore change, addition and removal
+ * of a weight, as well as variate generation, take O(log K),
+ * while the rest of weights are never renormalized.
+ * Sums are recomputed from children rather than updated by differences,
+ * so rounding errors don't accumulate and outcomes of zero weight are never generated.
+ *
+ * Related distributions: <BR>
+ * X ~ Cat(p_0, ..., p_{K-1}) with p_k = w_k / (w_0 + ... + w_{K-1})
+ */
+template < typename IntType = int >
+class RANDLIBSHARED_EXPORT DynamicCategoricalRand : public DiscreteDistribution<IntType>
+{
+    std::vector<double> tree{0.0, 1.0}; ///< segment tree: tree[1] is total weight, leaves start from capacity
+    size_t capacity = 1; ///< number of leaves, power of 2
+    IntType K = 1; ///< number of possible outcomes
+
+    /**
+     * @fn updateAncestors
+     * recomputes sums on the path from the leaf to the root
+     * @param leaf index of the leaf in the tree
+     */
+    void updateAncestors(size_t leaf);
+
+    /**
+     * @fn reserve
+     * grows the tree, such that it fits given number of outcomes
+     * @param size
+     */
+    void reserve(size_t size);
+
+    /**
+     * @fn findOutcome
+     * @param x value on [0, total weight]
+     * @return outcome k, such that cumulative weight of outcomes before k
+     * is not greater than x and cumulative weight up to k is greater than x
+     */
+    IntType findOutcome(double x) const;
+
+    /**
+     * @fn cumulativeWeight
+     * @param k
+     * @return w_0 + ... + w_k
+     */
+    double cumulativeWeight(IntType k) const;
+
+public:
+    explicit DynamicCategoricalRand(std::vector<double>&& weights = {1.0});
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override { return FINITE_T; }
+    IntType MinValue() const override { return 0; }
+    IntType MaxValue() const override { return K - 1; }
+
+    /**
+     * @fn SetWeights
+     * rebuilds the distribution in O(K)
+     * @param weights non-negative, not all equal to zero
+     */
+    void SetWeights(std::vector<double>&& weights);
+    /**
+     * @fn SetWeight
+     * changes weight of outcome k in O(log K)
+     * @param k
+     * @param weight
+     */
+    void SetWeight(IntType k, double weight);
+    /**
+     * @fn AddOutcome
+     * adds outcome K in O(log K) (amortized)
+     * @param weight
+     * @return index of the new outcome
+     */
+    IntType AddOutcome(double weight);
+    /**
+     * @fn RemoveOutcome
+     * sets weight of outcome k to zero in O(log K),
+     * indices of other outcomes stay the same. Outcomes of zero weight
+     * at the end are dropped, hence K decreases if k is the last one
+     * @param k
+     */
+    void RemoveOutcome(IntType k);
+    double GetWeight(IntType k) const { return (k < 0 || k >= K) ? 0.0 : tree[capacity + k]; }
+    double GetTotalWeight() const { return tree[1]; }
+    std::vector<double> GetProbabilities() const;
+
+    double P(const IntType & k) const override;
+    double logP(const IntType & k) const override;
+    double F(const IntType & k) const override;
+    double S(const IntType & k) const override;
+    IntType Variate() const override;
+    void Sample(std::vector<IntType> &outputData) const override;
+
+    long double Mean() const override;
+    long double Variance() const override;
+    IntType Mode() const override;
+
+private:
+    IntType quantileImpl(double p) const override;
+    IntType quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
+    std::complex<double> CFImpl(double t) const override;
+};
+
+#endif // DYNAMICCATEGORICALRAND_H
@@ -1,4 +1,5 @@
 #include "HyperGeometricRand.h"
+#include "../continuous/UniformRand.h"
 
 template < typename IntType >
 HyperGeometricRand<IntType>::HyperGeometricRand(IntType totalSize, IntType drawsNum, IntType successesNum)
@@ -28,12 +29,16 @@ void HyperGeometricRand<IntType>::SetParameters(IntType totalSize, IntType draws
     n = drawsNum;
     K = successesNum;
 
-    p0 = static_cast<double>(K) / N;
     pmfCoef = RandMath::lfact(K);
     pmfCoef += RandMath::lfact(N - K);
     pmfCoef += RandMath::lfact(N - n);
     pmfCoef += RandMath::lfact(n);
     pmfCoef -= RandMath::lfact(N);
+
+    if (generateByInversion())
+        pMin = P(MinValue());
+    else
+        ratioOfUniforms = this->ratioOfUniformsConstants();
 }
 
 template < typename IntType >
@@ -77,24 +82,37 @@ double HyperGeometricRand<IntType>::F(const IntType & k) const
 }
 
 template < typename IntType >
-IntType HyperGeometricRand<IntType>::Variate() const
+bool HyperGeometricRand<IntType>::generateByInversion() const
+{
+    /// width of the support doesn't exceed any of these values
+    return std::min({n, N - n, K, N - K}) < 10;
+}
+
+template < typename IntType >
+IntType HyperGeometricRand<IntType>::variateInversion() const
 {
-    double p = p0;
-    IntType sum = 0;
-    for (int i = 1; i <= n; ++i)
-    {
-        if (BernoulliRand::Variate(p, this->localRandGenerator) && ++sum >= K)
-            return sum;
-        p = K - sum;
-        p /= N - i;
+    double U = UniformRand<double>::StandardVariate(this->localRandGenerator);
+    IntType k = MinValue(), maxVal = MaxValue();
+    double p = pMin;
+    while (U > p && k < maxVal) {
+        U -= p;
+        /// P(X = k + 1) / P(X = k)
+        p *= static_cast<double>(K - k) * (n - k) / ((k + 1.0) * (N - K - n + k + 1.0));
+        ++k;
     }
-    return sum;
+    return k;
+}
+
+template < typename IntType >
+IntType HyperGeometricRand<IntType>::Variate() const
+{
+    return generateByInversion() ? variateInversion() : this->variateRatioOfUniforms(ratioOfUniforms);
 }
 
 template < typename IntType >
 long double HyperGeometricRand<IntType>::Mean() const
 {
-    return static_cast<double>(n * K) / N;
+    return static_cast<double>(n) * K / N;
 }
 
 template < typename IntType >
@@ -113,7 +131,7 @@ long double HyperGeometricRand<IntType>::Variance() const
 template < typename IntType >
 IntType HyperGeometricRand<IntType>::Mode() const
 {
-    double mode = (n + 1) * (K + 1);
+    double mode = static_cast<double>(n + 1) * (K + 1);
     return std::floor(mode / (N + 2));
 }
 
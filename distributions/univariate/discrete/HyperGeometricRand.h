@@ -2,7 +2,6 @@
 #define HYPERGEOMETRICRAND_H
 
 #include "DiscreteDistribution.h"
-#include "BernoulliRand.h"
 #include "BetaBinomialRand.h"
 
 /**
@@ -18,7 +17,8 @@ class RANDLIBSHARED_EXPORT HyperGeometricRand : public DiscreteDistribution<IntT
     IntType K = 1; /// number of possible successes
     IntType n = 1; /// number of draws
     double pmfCoef = 1; ///< C(N, n)
-    double p0 = 1; ///< K/N
+    double pMin = 1; ///< P(X = MinValue())
+    typename DiscreteDistribution<IntType>::RatioOfUniformsConstants ratioOfUniforms{};
 
 public:
     HyperGeometricRand(IntType totalSize = 1, IntType drawsNum = 1, IntType successesNum = 1);
@@ -35,6 +35,16 @@ public:
     double P(const IntType & k) const override;
     double logP(const IntType & k) const override;
     double F(const IntType & k) const override;
+
+private:
+    /**
+     * @fn generateByInversion
+     * @return true if support is small enough for sequential inversion
+     */
+    bool generateByInversion() const;
+    IntType variateInversion() const;
+
+public:
     IntType Variate() const override;
 
     long double Mean() const override;
@@ -157,6 +157,13 @@ void NegativeBinomialDistribution<IntType, T>::Reseed(unsigned long seed) const
     GammaRV.Reseed(seed + 1);
 }
 
+template< typename IntType, typename T>
+void NegativeBinomialDistribution<IntType, T>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    GammaRV.Discard(variatesNum);
+}
+
 template< typename IntType, typename T>
 long double NegativeBinomialDistribution<IntType, T>::Mean() const
 {
@@ -86,6 +86,7 @@ public:
     IntType Variate() const override;
     void Sample(std::vector<IntType> &outputData) const override;
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
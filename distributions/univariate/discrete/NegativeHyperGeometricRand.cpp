@@ -1,4 +1,5 @@
 #include "NegativeHyperGeometricRand.h"
+#include "../continuous/UniformRand.h"
 
 template < typename IntType >
 NegativeHyperGeometricRand<IntType>::NegativeHyperGeometricRand(IntType totalSize, IntType totalSuccessesNum, IntType limitSuccessesNum)
@@ -28,12 +29,16 @@ void NegativeHyperGeometricRand<IntType>::SetParameters(IntType totalSize, IntTy
     M = totalSuccessesNum;
     m = limitSuccessesNum;
 
-    p0 = static_cast<double>(M) / N;
     pmfCoef = RandMath::lfact(M);
     pmfCoef += RandMath::lfact(N - M);
     pmfCoef -= RandMath::lfact(m - 1);
     pmfCoef -= RandMath::lfact(M - m);
     pmfCoef -= RandMath::lfact(N);
+
+    if (generateByInversion())
+        pMin = P(0);
+    else
+        ratioOfUniforms = this->ratioOfUniformsConstants();
 }
 
 template < typename IntType >
@@ -78,19 +83,31 @@ double NegativeHyperGeometricRand<IntType>::F(const IntType &k) const
 }
 
 template < typename IntType >
-IntType NegativeHyperGeometricRand<IntType>::Variate() const
+bool NegativeHyperGeometricRand<IntType>::generateByInversion() const
+{
+    return Mean() < 10;
+}
+
+template < typename IntType >
+IntType NegativeHyperGeometricRand<IntType>::variateInversion() const
 {
-    double p = p0;
-    IntType successesNum = 0;
-    IntType num = 0;
-    while (successesNum < m) {
-        ++num;
-        if (BernoulliRand::Variate(p, this->localRandGenerator) && ++successesNum == num - N + M)
-            return N - M;
-        p = M - successesNum;
-        p /= N - num;
+    double U = UniformRand<double>::StandardVariate(this->localRandGenerator);
+    IntType k = 0, maxVal = MaxValue();
+    double p = pMin;
+    while (U > p && k < maxVal) {
+        U -= p;
+        /// P(X = k + 1) / P(X = k)
+        p *= static_cast<double>(k + m) * (N - M - k) / ((k + 1.0) * (N - m - k));
+        ++k;
     }
-    return num - successesNum;
+    return k;
+}
+
+template < typename IntType >
+IntType NegativeHyperGeometricRand<IntType>::Variate() const
+{
+    /// the distribution is log-concave, hence ratio-of-uniforms method is applicable
+    return generateByInversion() ? variateInversion() : this->variateRatioOfUniforms(ratioOfUniforms);
 }
 
 template < typename IntType >
@@ -113,6 +130,16 @@ long double NegativeHyperGeometricRand<IntType>::Variance() const
     return m * var;
 }
 
+template < typename IntType >
+IntType NegativeHyperGeometricRand<IntType>::Mode() const
+{
+    /// P(X = k + 1) >= P(X = k) iff k <= (m - 1)(N - M + 1) / (M - 1) - 1
+    if (M == 1)
+        return 0;
+    double mode = static_cast<double>(m - 1) * (N - M + 1) / (M - 1);
+    return std::min(static_cast<IntType>(std::floor(mode)), MaxValue());
+}
+
 template class NegativeHyperGeometricRand<int>;
 template class NegativeHyperGeometricRand<long int>;
 template class NegativeHyperGeometricRand<long long int>;
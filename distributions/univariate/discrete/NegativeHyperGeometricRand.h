@@ -2,7 +2,6 @@
 #define NEGATIVEHYPERGEOMETRICRAND_H
 
 #include "DiscreteDistribution.h"
-#include "BernoulliRand.h"
 
 /**
  * @brief The NegativeHyperGeometricRand class <BR>
@@ -17,7 +16,8 @@ class RANDLIBSHARED_EXPORT NegativeHyperGeometricRand : public DiscreteDistribut
     IntType M = 1; ///< total amount of successes
     IntType m = 1; ///< limiting number of successes
     double pmfCoef = 1; ///< C(N, M)
-    double p0 = 1; ///< M / N
+    double pMin = 1; ///< P(X = 0)
+    typename DiscreteDistribution<IntType>::RatioOfUniformsConstants ratioOfUniforms{};
 
 public:
     NegativeHyperGeometricRand(IntType totalSize = 1, IntType totalSuccessesNum = 1, IntType limitSuccessesNum = 1);
@@ -34,10 +34,21 @@ public:
     double P(const IntType & k) const override;
     double logP(const IntType & k) const override;
     double F(const IntType & k) const override;
+
+private:
+    /**
+     * @fn generateByInversion
+     * @return true if mean is small enough for sequential inversion
+     */
+    bool generateByInversion() const;
+    IntType variateInversion() const;
+
+public:
     IntType Variate() const override;
 
     long double Mean() const override;
     long double Variance() const override;
+    IntType Mode() const override;
 };
 
 #endif // NEGATIVEHYPERGEOMETRICRAND_H
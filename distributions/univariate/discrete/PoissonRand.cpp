@@ -233,17 +233,64 @@ IntType PoissonRand<IntType>::Variate() const
     return generateByInversion() ? variateInversion() : variateRejection();
 }
 
+template < typename IntType >
+typename PoissonRand<IntType>::TransformedRejectionConstants PoissonRand<IntType>::transformedRejectionConstants(double rate)
+{
+    TransformedRejectionConstants constants;
+    constants.rate = rate;
+    constants.logRate = std::log(rate);
+    constants.b = 0.931 + 2.53 * std::sqrt(rate);
+    constants.a = -0.059 + 0.02483 * constants.b;
+    constants.logInvAlpha = std::log(1.1239 + 1.1328 / (constants.b - 3.4));
+    constants.vr = 0.9277 - 3.6224 / (constants.b - 2);
+    return constants;
+}
+
+template < typename IntType >
+IntType PoissonRand<IntType>::variateTransformedRejection(const TransformedRejectionConstants &constants, RandGenerator &randGenerator)
+{
+    /// W. Hörmann, "The transformed rejection method for generating Poisson random variables", 1993
+    const double a = constants.a, b = constants.b;
+    size_t iter = 0;
+    do {
+        double U = UniformRand<double>::StandardVariate(randGenerator) - 0.5;
+        double V = UniformRand<double>::StandardVariate(randGenerator);
+        double us = 0.5 - std::fabs(U);
+        double X = std::floor((2 * a / us + b) * U + constants.rate + 0.43);
+        /// squeeze acceptance
+        if (us >= 0.07 && V <= constants.vr)
+            return X;
+        if (X < 0 || (us < 0.013 && V > us))
+            continue;
+        double logAcceptance = std::log(V) + constants.logInvAlpha - std::log(a / (us * us) + b);
+        if (logAcceptance <= X * constants.logRate - constants.rate - RandMath::lfact(X))
+            return X;
+    } while (++iter < ProbabilityDistribution<IntType>::MAX_ITER_REJECTION);
+    throw std::runtime_error("Poisson distribution: sampling failed");
+}
+
+template < typename IntType >
+IntType PoissonRand<IntType>::variateInversion(double rate, double expMinusRate, RandGenerator &randGenerator)
+{
+    double U = UniformRand<double>::StandardVariate(randGenerator);
+    IntType k = 0;
+    double p = expMinusRate, s = p;
+    while (s < U && p > 0) {
+        ++k;
+        p *= rate / k;
+        s += p;
+    }
+    return k;
+}
+
 template < typename IntType >
 IntType PoissonRand<IntType>::Variate(double rate, RandGenerator &randGenerator)
 {
     /// check validness of parameter
     if (rate <= 0.0)
         throw std::invalid_argument("Poisson distribution: rate should be positive");
-    if (rate > 1000) {
-        /// approximate with normal distribution
-        float X = NormalRand<float>::StandardVariate(randGenerator);
-        return std::floor(rate + std::sqrt(rate) * X);
-    }
+    if (rate >= 10)
+        return variateTransformedRejection(transformedRejectionConstants(rate), randGenerator);
     int k = -1;
     double s = 0;
     do {
@@ -253,6 +300,43 @@ IntType PoissonRand<IntType>::Variate(double rate, RandGenerator &randGenerator)
     return k;
 }
 
+template < typename IntType >
+void PoissonRand<IntType>::Variates(const std::vector<double> &rates, std::vector<IntType> &outputData, RandGenerator &randGenerator)
+{
+    for (double rate : rates) {
+        if (!(rate > 0.0))
+            throw std::invalid_argument("Poisson distribution: rate should be positive");
+    }
+    outputData.resize(rates.size());
+    /// elements are processed in blocks, which fit into cache:
+    /// indices are grouped by algorithm (inversion for small rates, transformed rejection otherwise),
+    /// setup of each group is computed in a separate loop, and then the group is sampled
+    static constexpr size_t BLOCK_SIZE = 256;
+    size_t small[BLOCK_SIZE], large[BLOCK_SIZE];
+    double expMinusRate[BLOCK_SIZE];
+    TransformedRejectionConstants constants[BLOCK_SIZE];
+    for (size_t start = 0; start < rates.size(); start += BLOCK_SIZE) {
+        size_t end = std::min(start + BLOCK_SIZE, rates.size());
+        size_t smallSize = 0, largeSize = 0;
+        for (size_t i = start; i != end; ++i) {
+            if (rates[i] < 10)
+                small[smallSize++] = i;
+            else
+                large[largeSize++] = i;
+        }
+
+        for (size_t j = 0; j != smallSize; ++j)
+            expMinusRate[j] = std::exp(-rates[small[j]]);
+        for (size_t j = 0; j != smallSize; ++j)
+            outputData[small[j]] = variateInversion(rates[small[j]], expMinusRate[j], randGenerator);
+
+        for (size_t j = 0; j != largeSize; ++j)
+            constants[j] = transformedRejectionConstants(rates[large[j]]);
+        for (size_t j = 0; j != largeSize; ++j)
+            outputData[large[j]] = variateTransformedRejection(constants[j], randGenerator);
+    }
+}
+
 template < typename IntType >
 void PoissonRand<IntType>::Sample(std::vector<IntType> &outputData) const
 {
@@ -60,10 +60,48 @@ private:
     bool generateByInversion() const;
     IntType variateRejection() const;
     IntType variateInversion() const;
+    /**
+     * @fn variateInversion
+     * inversion from zero, used for small rates
+     * @param rate
+     * @param expMinusRate exp(-rate)
+     * @param randGenerator
+     * @return Poisson variate
+     */
+    static IntType variateInversion(double rate, double expMinusRate, RandGenerator &randGenerator);
+
+    /**
+     * @brief The TransformedRejectionConstants struct
+     * setup of PTRS algorithm, which depends only on rate
+     */
+    struct TransformedRejectionConstants
+    {
+        double rate = 10, logRate = 0;
+        double a = 0, b = 0;
+        double logInvAlpha = 0, vr = 0;
+    };
+    static TransformedRejectionConstants transformedRejectionConstants(double rate);
+    /**
+     * @fn variateTransformedRejection
+     * PTRS algorithm, exact with bounded expected number of iterations, valid for rate >= 10
+     * @param constants
+     * @param randGenerator
+     * @return Poisson variate
+     */
+    static IntType variateTransformedRejection(const TransformedRejectionConstants &constants, RandGenerator &randGenerator);
 
 public:
     IntType Variate() const override;
     static IntType Variate(double rate, RandGenerator &randGenerator = ProbabilityDistribution<IntType>::staticRandGenerator);
+    /**
+     * @fn Variates
+     * one variate per rate: elements are grouped by used algorithm
+     * and setup constants of each group are computed in a separate loop
+     * @param rates
+     * @param outputData
+     * @param randGenerator
+     */
+    static void Variates(const std::vector<double> &rates, std::vector<IntType> &outputData, RandGenerator &randGenerator = ProbabilityDistribution<IntType>::staticRandGenerator);
     void Sample(std::vector<IntType> &outputData) const;
 
     long double Mean() const override;
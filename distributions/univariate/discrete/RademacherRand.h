@@ -39,6 +39,7 @@ public:
 private:
     int quantileImpl(double p) const override;
     int quantileImpl1m(double p) const override;
+    bool canWarmStartQuantile() const override { return false; }
     std::complex<double> CFImpl(double t) const override;
 
 public:
@@ -78,6 +78,13 @@ void SkellamRand<IntType>::Reseed(unsigned long seed) const
     Y.Reseed(seed + 1);
 }
 
+template < typename IntType >
+void SkellamRand<IntType>::Discard(unsigned long long variatesNum) const
+{
+    X.Discard(variatesNum);
+    Y.Discard(variatesNum);
+}
+
 template < typename IntType >
 long double SkellamRand<IntType>::Mean() const
 {
@@ -1,5 +1,41 @@
 #include "UniformDiscreteRand.h"
 
+namespace
+{
+
+#ifdef __SIZEOF_INT128__
+/// the extension keeps -pedantic quiet
+__extension__ typedef unsigned __int128 uint128;
+#endif
+
+/**
+ * @fn multiplyHigh
+ * @param x
+ * @param y
+ * @param low lower 64 bits of x * y
+ * @return upper 64 bits of x * y
+ */
+inline unsigned long long multiplyHigh(unsigned long long x, unsigned long long y, unsigned long long &low)
+{
+#ifdef __SIZEOF_INT128__
+    uint128 product = static_cast<uint128>(x) * y;
+    low = product;
+    return product >> 64;
+#else
+    unsigned long long x0 = x & 0xFFFFFFFF, x1 = x >> 32;
+    unsigned long long y0 = y & 0xFFFFFFFF, y1 = y >> 32;
+    unsigned long long p00 = x0 * y0, p01 = x0 * y1, p10 = x1 * y0, p11 = x1 * y1;
+    unsigned long long middle = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+    low = (middle << 32) | (p00 & 0xFFFFFFFF);
+    return p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+#endif
+}
+
+/// number of outcomes for the whole range of 64-bit type, where n wraps to 0
+constexpr double TWO_POW_64 = 18446744073709551616.0;
+
+}
+
 template< typename IntType >
 UniformDiscreteRand<IntType>::UniformDiscreteRand(IntType minValue, IntType maxValue)
 {
@@ -21,12 +57,28 @@ void UniformDiscreteRand<IntType>::SetBoundaries(IntType minValue, IntType maxVa
     a = minValue;
     b = maxValue;
 
-    n = b - a + 1;
+    /// unsigned arithmetic is exact modulo 2^64, so n wraps to 0 for the whole range of 64-bit IntType
+    n = static_cast<unsigned long long>(b) - static_cast<unsigned long long>(a) + 1;
+    if (n == 0) {
+        /// every 64-bit word is a variate
+        nInv = 1.0 / TWO_POW_64;
+        logN = 64 * M_LN2;
+        variatesPerWord = 1;
+        wordThreshold = 0;
+        return;
+    }
     nInv = 1.0 / n;
     logN = std::log(n);
 
-    unsigned long long MAX_RAND = this->localRandGenerator.MaxValue();
-    MAX_RAND_UNBIASED = MAX_RAND - MAX_RAND % n - 1;
+    /// largest power of n, which keeps probability of rejection below 2^-8
+    static constexpr unsigned long long MAX_WORD_BOUND = 1ULL << 56;
+    unsigned long long wordBound = n;
+    variatesPerWord = 1;
+    while (n > 1 && wordBound <= MAX_WORD_BOUND / n) {
+        wordBound *= n;
+        ++variatesPerWord;
+    }
+    wordThreshold = (0 - wordBound) % wordBound;
 }
 
 template< typename IntType >
@@ -46,34 +98,92 @@ double UniformDiscreteRand<IntType>::F(const IntType & k) const
 {
     if (k < a)
         return 0.0;
-    if (k > b)
+    if (k >= b)
         return 1.0;
-    return (k - a + 1) * nInv;
+    /// unsigned difference doesn't overflow for any k in [a, b)
+    return (static_cast<unsigned long long>(k) - static_cast<unsigned long long>(a) + 1) * nInv;
+}
+
+template< typename IntType >
+unsigned long long UniformDiscreteRand<IntType>::boundedVariate(unsigned long long bound, RandGenerator &randGenerator)
+{
+    if (bound == 0)
+        return randomWord(randGenerator);
+    if (ENGINE_BITS == 32 && bound <= (1ULL << 32)) {
+        /// product of 32-bit word and bound fits in 64 bits
+        unsigned long long product = randGenerator.Variate() * bound;
+        if ((product & 0xFFFFFFFF) < bound) {
+            unsigned long long threshold = ((1ULL << 32) - bound) % bound;
+            while ((product & 0xFFFFFFFF) < threshold)
+                product = randGenerator.Variate() * bound;
+        }
+        return product >> 32;
+    }
+    unsigned long long low;
+    unsigned long long high = multiplyHigh(randomWord(randGenerator), bound, low);
+    if (low < bound) {
+        unsigned long long threshold = (0 - bound) % bound;
+        while (low < threshold)
+            high = multiplyHigh(randomWord(randGenerator), bound, low);
+    }
+    return high;
 }
 
 template< typename IntType >
 IntType UniformDiscreteRand<IntType>::Variate() const
 {
-    unsigned long intVar;
-    do {
-        intVar = this->localRandGenerator.Variate();
-    } while (intVar > MAX_RAND_UNBIASED);
-    return a + (intVar % n);
+    return static_cast<unsigned long long>(a) + boundedVariate(n, this->localRandGenerator);
+}
+
+template< typename IntType >
+void UniformDiscreteRand<IntType>::Sample(std::vector<IntType> &outputData) const
+{
+    if (n == 1) {
+        std::fill(outputData.begin(), outputData.end(), a);
+        return;
+    }
+    if (n == 0) {
+        /// whole range of 64-bit IntType, raw words need no reduction
+        const unsigned long long shift = a;
+        for (IntType &var : outputData)
+            var = shift + randomWord(this->localRandGenerator);
+        return;
+    }
+    /// generate raw words in blocks, every accepted 64-bit word x gives digits
+    /// of x * n^k / 2^64 in base n, such that x * n^k mod 2^64 is not below 2^64 mod n^k
+    static constexpr size_t BLOCK_SIZE = 256;
+    static constexpr size_t ENGINE_WORDS = 64 / ENGINE_BITS;
+    unsigned long long words[BLOCK_SIZE * ENGINE_WORDS];
+    const unsigned long long shift = a;
+    IntType *output = outputData.data();
+    size_t size = outputData.size(), i = 0;
+    while (i != size) {
+        size_t blockSize = std::min(BLOCK_SIZE, (size - i + variatesPerWord - 1) / variatesPerWord);
+        this->localRandGenerator.Fill(words, blockSize * ENGINE_WORDS);
+        for (size_t j = 0; j != blockSize && i != size; ++j) {
+            unsigned long long low = words[j * ENGINE_WORDS];
+            if constexpr (ENGINE_BITS == 32)
+                low = (low << 32) | words[2 * j + 1];
+            size_t count = std::min(variatesPerWord, size - i);
+            for (size_t k = 0; k != count; ++k)
+                output[i + k] = shift + multiplyHigh(low, n, low);
+            /// the rest of digits doesn't need to be stored, but takes part in acceptance
+            for (size_t k = count; k != variatesPerWord; ++k)
+                multiplyHigh(low, n, low);
+            if (low >= wordThreshold)
+                i += count;
+        }
+    }
 }
 
 template< typename IntType >
 IntType UniformDiscreteRand<IntType>::StandardVariate(IntType minValue, IntType maxValue, RandGenerator &randGenerator)
 {
-    unsigned long long MAX_RAND = randGenerator.MaxValue();
-    IntType n = maxValue - minValue + 1;
-    if (n <= 1)
+    if (minValue >= maxValue)
         return minValue;
-    unsigned long long MAX_RAND_UNBIASED = MAX_RAND - MAX_RAND % n - 1;
-    unsigned long intVar;
-    do {
-        intVar = randGenerator.Variate();
-    } while (intVar > MAX_RAND_UNBIASED);
-    return minValue + (intVar % n);
+    unsigned long long shift = minValue;
+    unsigned long long n = static_cast<unsigned long long>(maxValue) - shift + 1;
+    return shift + boundedVariate(n, randGenerator);
 }
 
 template< typename IntType >
@@ -85,9 +195,8 @@ long double UniformDiscreteRand<IntType>::Mean() const
 template< typename IntType >
 long double UniformDiscreteRand<IntType>::Variance() const
 {
-    double nm1 = n - 1;
-    double np1 = n + 1;
-    return nm1 * np1 / 12;
+    double nD = (n == 0) ? TWO_POW_64 : n;
+    return (nD - 1) * (nD + 1) / 12;
 }
 
 template< typename IntType >
@@ -112,8 +221,8 @@ long double UniformDiscreteRand<IntType>::Skewness() const
 template< typename IntType >
 long double UniformDiscreteRand<IntType>::ExcessKurtosis() const
 {
-    double kurt = n;
-    kurt *= n;
+    double kurt = (n == 0) ? TWO_POW_64 : n;
+    kurt *= kurt;
     --kurt;
     kurt = 2.0 / kurt;
     ++kurt;
@@ -142,7 +251,7 @@ template< typename IntType >
 double UniformDiscreteRand<IntType>::LikelihoodFunction(const std::vector<IntType> &sample) const
 {
     bool sampleIsInsideInterval = this->allElementsAreNotSmallerThan(a, sample) && this->allElementsAreNotGreaterThan(b, sample);
-    return sampleIsInsideInterval ? std::pow(n, -sample.size()) : 0.0;
+    return sampleIsInsideInterval ? std::pow(nInv, sample.size()) : 0.0;
 }
 
 template< typename IntType >
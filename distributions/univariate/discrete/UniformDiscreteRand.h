@@ -15,12 +15,40 @@
 template< typename IntType = int >
 class RANDLIBSHARED_EXPORT UniformDiscreteRand : public DiscreteDistribution<IntType>
 {
-    size_t n = 1; ///< number of possible outcomes
+    unsigned long long n = 1; ///< number of possible outcomes, 0 stands for 2^64
     IntType a = 0; ///< min bound
     IntType b = 0; ///< max bound
     double nInv = 1; ///< 1/n
     double logN = 0; ///< log(n)
-    unsigned long long MAX_RAND_UNBIASED = this->localRandGenerator.MaxValue();///< constant for unbiased generator
+    size_t variatesPerWord = 1; ///< amount of variates, which Sample takes from one 64-bit word
+    unsigned long long wordThreshold = 0; ///< 2^64 mod n^variatesPerWord
+
+    /// amount of bits in the words of the generator
+    static constexpr int ENGINE_BITS = (RandGenerator::MaxValue() >> 32) ? 64 : 32;
+
+    /**
+     * @fn randomWord
+     * @param randGenerator
+     * @return random integer on [0, 2^64)
+     */
+    static inline unsigned long long randomWord(RandGenerator &randGenerator)
+    {
+        if constexpr (ENGINE_BITS == 64)
+            return randGenerator.Variate();
+        unsigned long long high = randGenerator.Variate();
+        return (high << 32) | randGenerator.Variate();
+    }
+
+    /**
+     * @fn boundedVariate
+     * multiply-shift range reduction with rejection
+     * (Lemire, "Fast random integer generation in an interval", 2019):
+     * the modulo is evaluated only with probability bound / 2^w
+     * @param bound number of outcomes, 0 stands for 2^64
+     * @param randGenerator
+     * @return random integer on [0, bound)
+     */
+    static unsigned long long boundedVariate(unsigned long long bound, RandGenerator &randGenerator);
 
 public:
     UniformDiscreteRand(IntType minValue = 0, IntType maxValue = 1);
@@ -36,6 +64,13 @@ public:
     double F(const IntType & k) const override;
 
     IntType Variate() const override;
+    /**
+     * @fn Sample
+     * splits every 64-bit word into several variates, if n is small enough
+     * (Brackett-Rozinsky, Lemire, "Batched ranged random integer generation", 2024)
+     * @param outputData
+     */
+    void Sample(std::vector<IntType> &outputData) const override;
     static IntType StandardVariate(IntType minValue = 0, IntType maxValue = 1, RandGenerator &randGenerator = ProbabilityDistribution<IntType>::staticRandGenerator);
 
     long double Mean() const override;
@@ -82,6 +82,13 @@ void YuleRand<IntType>::Reseed(unsigned long seed) const
     X.Reseed(seed + 1);
 }
 
+template < typename IntType >
+void YuleRand<IntType>::Discard(unsigned long long variatesNum) const
+{
+    this->localRandGenerator.Discard(variatesNum);
+    X.Discard(variatesNum);
+}
+
 template < typename IntType >
 long double YuleRand<IntType>::Mean() const
 {
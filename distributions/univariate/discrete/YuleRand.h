@@ -38,6 +38,7 @@ public:
     IntType Variate() const override;
     static IntType Variate(double shape, RandGenerator &randGenerator = ProbabilityDistribution<IntType>::staticRandGenerator);
     void Reseed(unsigned long seed) const override;
+    void Discard(unsigned long long variatesNum) const override;
 
     long double Mean() const override;
     long double Variance() const override;
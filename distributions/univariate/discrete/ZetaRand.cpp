@@ -1,6 +1,4 @@
 #include "ZetaRand.h"
-#include "../continuous/UniformRand.h"
-#include "../continuous/ParetoRand.h"
 
 template < typename IntType >
 ZetaRand<IntType>::ZetaRand(double exponent)
@@ -23,7 +21,9 @@ void ZetaRand<IntType>::SetExponent(double exponent)
     sm1 = s - 1.0;
     zetaS = std::riemann_zetal(s);
     logZetaS = std::log(zetaS);
-    b = -std::expm1l(-sm1 * M_LN2);
+    hIntegralX1 = ZipfRand<IntType>::hIntegral(1.5, s) - 1.0;
+    hIntegralInf = 1.0 / sm1;
+    threshold = ZipfRand<IntType>::acceptanceThreshold(1.0, s);
 }
 
 template < typename IntType >
@@ -41,27 +41,10 @@ double ZetaRand<IntType>::F(const IntType & k) const
 template < typename IntType >
 IntType ZetaRand<IntType>::Variate() const
 {
-    /// Luc Devroye, p. 551
-    /// rejection sampling from rounded down Pareto distribution
-    size_t iter = 0;
-    do {
-        float X = std::floor(ParetoRand<float>::StandardVariate(sm1, this->localRandGenerator));
-        float V = UniformRand<float>::StandardVariate(this->localRandGenerator);
-        if (X < 1e4) {
-            float T = std::pow(1.0 + 1.0 / X, sm1);
-            /// there was a typo in the book - '<=' instead of '>'
-            if (V * X * (T - 1) <= b * T)
-                return X;
-        }
-        else {
-            long double logT = sm1 * std::log1pl(1.0 / X);
-            long double TM1 = std::expm1l(logT);
-            if (V * X * TM1 <= b * std::exp(logT))
-                return X < this->MaxValue() ? (IntType)X : this->MaxValue();
-        }
-
-    } while (++iter <= ProbabilityDistribution<IntType>::MAX_ITER_REJECTION);
-    throw std::runtime_error("Zeta distribution: sampling failed");
+    /// rejection-inversion of Zipf distribution with infinite number of elements,
+    /// computed in double precision, such that large values are not rounded
+    double X = ZipfRand<IntType>::rejectionInversionVariate(s, 1.0, this->MaxValue(), hIntegralX1, hIntegralInf, threshold, this->localRandGenerator);
+    return X < this->MaxValue() ? (IntType)X : this->MaxValue();
 }
 
 template < typename IntType >
@@ -2,6 +2,7 @@
 #define ZETARAND_H
 
 #include "DiscreteDistribution.h"
+#include "ZipfRand.h"
 
 /**
  * @brief The ZetaRand class <BR>
@@ -18,7 +19,9 @@ class RANDLIBSHARED_EXPORT ZetaRand : public DiscreteDistribution<IntType>
     double sm1 = 1; ///< s - 1
     double zetaS = M_PI_SQ / 6.0; ///< ζ(s), where ζ stands for Riemann zeta-function
     double logZetaS = 2 * M_LNPI - M_LN2 - M_LN3;///< ln(ζ(s))
-    double b = 0.5; ///< 1 - 2^(1-s)
+    double hIntegralX1 = 0; ///< H(1.5) - 1, see ZipfRand
+    double hIntegralInf = 1; ///< H(∞) = 1 / (s - 1)
+    double threshold = 0; ///< k - x <= threshold guarantees acceptance
 
 public:
     explicit ZetaRand(double exponent = 2.0);
@@ -39,6 +39,67 @@ void ZipfRand<IntType>::SetParameters(double exponent, IntType number)
         table[hashedVarNum - 1] = table[hashedVarNum - 2] + std::pow(hashedVarNum, -s);
     for (int i = 0; i < hashedVarNum; ++i)
         table[i] *= invHarmonicNumber;
+
+    /// constants of rejection-inversion for the values, which are not hashed
+    double m = hashedVarNum + 1;
+    hIntegralM = hIntegral(m + 0.5, s) - h(m, s);
+    hIntegralN = hIntegral(n + 0.5, s);
+    threshold = acceptanceThreshold(m, s);
+}
+
+template < typename IntType >
+double ZipfRand<IntType>::h(double x, double exponent)
+{
+    return std::exp(-exponent * std::log(x));
+}
+
+template < typename IntType >
+double ZipfRand<IntType>::hIntegral(double x, double exponent)
+{
+    /// (exp(y) - 1) / y * log(x), with y = (1 - s) * log(x), stable for s close to 1
+    double logX = std::log(x);
+    double y = (1.0 - exponent) * logX;
+    double expm1DivY = (std::fabs(y) > 1e-8) ? std::expm1(y) / y : 1.0 + 0.5 * y * (1.0 + y / 3.0);
+    return expm1DivY * logX;
+}
+
+template < typename IntType >
+double ZipfRand<IntType>::hIntegralInverse(double x, double exponent)
+{
+    double t = x * (1.0 - exponent);
+    /// t < -1 can appear only due to rounding
+    if (t < -1.0)
+        t = -1.0;
+    double log1pDivT = (std::fabs(t) > 1e-8) ? std::log1p(t) / t : 1.0 - t * (0.5 - t / 3.0);
+    return std::exp(log1pDivT * x);
+}
+
+template < typename IntType >
+double ZipfRand<IntType>::acceptanceThreshold(double lower, double exponent)
+{
+    double k = lower + 1.0;
+    return k - hIntegralInverse(hIntegral(k + 0.5, exponent) - h(k, exponent), exponent);
+}
+
+template < typename IntType >
+double ZipfRand<IntType>::rejectionInversionVariate(double exponent, double lower, double upper, double hIntegralM, double hIntegralN, double threshold, RandGenerator &randGenerator)
+{
+    /// W. Hörmann, G. Derflinger, "Rejection-inversion to generate variates
+    /// from monotone discrete distributions", 1996
+    size_t iter = 0;
+    do {
+        double U = UniformRand<double>::StandardVariate(randGenerator);
+        double u = hIntegralN + U * (hIntegralM - hIntegralN);
+        double x = hIntegralInverse(u, exponent);
+        double k = std::floor(x + 0.5);
+        if (k < lower)
+            k = lower;
+        else if (k > upper)
+            k = upper;
+        if (k - x <= threshold || u >= hIntegral(k + 0.5, exponent) - h(k, exponent))
+            return k;
+    } while (++iter <= ProbabilityDistribution<IntType>::MAX_ITER_REJECTION);
+    throw std::runtime_error("Zipf distribution: sampling failed");
 }
 
 template < typename IntType >
@@ -67,20 +128,12 @@ template < typename IntType >
 IntType ZipfRand<IntType>::Variate() const
 {
     double U = UniformRand<double>::StandardVariate(this->localRandGenerator);
-    int k = 1;
     /// if we didn't manage to hash values for such U
-    if (U > table[hashedVarNum - 1]) {
-        k = hashedVarNum;
-        double sum = table[hashedVarNum - 1];
-        do {
-            ++k;
-            sum += std::pow(k, -s) * invHarmonicNumber;
-        } while (sum < U);
-    }
-    else {
-        while (k <= hashedVarNum && table[k - 1] < U)
-            ++k;
-    }
+    if (U > table[hashedVarNum - 1])
+        return rejectionInversionVariate(s, hashedVarNum + 1, n, hIntegralM, hIntegralN, threshold, this->localRandGenerator);
+    int k = 1;
+    while (k < hashedVarNum && table[k - 1] < U)
+        ++k;
     return k;
 }
 
@@ -8,7 +8,12 @@
  * @brief The ZipfRand class <BR>
  * Zipf distribution
  *
+ * P(X = k) = 1 / (k^s * H(s, n)) for k = {1, ..., n}
+ *
  * Notation: X ~ Zipf(s, n)
+ *
+ * Related distributions: <BR>
+ * If X ~ Zeta(s), then X ~ Zipf(s, ∞)
  */
 template < typename IntType = int >
 class RANDLIBSHARED_EXPORT ZipfRand : public DiscreteDistribution<IntType>
@@ -21,6 +26,60 @@ class RANDLIBSHARED_EXPORT ZipfRand : public DiscreteDistribution<IntType>
     int hashedVarNum = 1;
     double table[tableSize];
 
+    double hIntegralM = 0; ///< H(m + 0.5) - h(m), where m = hashedVarNum + 1
+    double hIntegralN = 0; ///< H(n + 0.5)
+    double threshold = 0; ///< k - x <= threshold guarantees acceptance
+
+    /**
+     * @fn h
+     * @param x
+     * @param exponent
+     * @return x^(-exponent)
+     */
+    static double h(double x, double exponent);
+
+    /**
+     * @fn hIntegral
+     * @param x
+     * @param exponent
+     * @return H(x) = (x^(1 - exponent) - 1) / (1 - exponent), antiderivative of h
+     */
+    static double hIntegral(double x, double exponent);
+
+    /**
+     * @fn hIntegralInverse
+     * @param x
+     * @param exponent
+     * @return inverse function of H
+     */
+    static double hIntegralInverse(double x, double exponent);
+
+    /**
+     * @fn acceptanceThreshold
+     * @param lower
+     * @param exponent
+     * @return k - H^(-1)(H(k + 0.5) - h(k)) for k = lower + 1
+     */
+    static double acceptanceThreshold(double lower, double exponent);
+
+    /**
+     * @fn rejectionInversionVariate
+     * Hörmann and Derflinger rejection-inversion:
+     * inversion of H for the hat, which bounds the point probabilities,
+     * with expected number of iterations bounded for any s and n
+     * @param exponent
+     * @param lower
+     * @param upper
+     * @param hIntegralM H(lower + 0.5) - h(lower)
+     * @param hIntegralN H(upper + 0.5)
+     * @param threshold acceptanceThreshold(lower, exponent)
+     * @param randGenerator
+     * @return random variable on {lower, ..., upper} with P(X = k) proportional to k^(-exponent)
+     */
+    static double rejectionInversionVariate(double exponent, double lower, double upper, double hIntegralM, double hIntegralN, double threshold, RandGenerator &randGenerator);
+
+    template < typename > friend class ZetaRand;
+
 public:
     ZipfRand(double exponent = 2.0, IntType number = 1);
 
@@ -1,4 +1,5 @@
 #include "BetaMath.h"
+#include "VectorMath.h"
 
 namespace RandMath {
 
@@ -162,4 +163,310 @@ double ibeta(double x, double a, double b)
     return ibeta(x, a, b, logBetaFun, logX, log1mX);
 }
 
+/**
+ * @fn ibetaPowerSeriesBlocks
+ * Power series of ibetaPowerSeries1 (c = -b, v = -x / (1 - x)) and ibetaPowerSeries2 (c = a + b - 1, v = x)
+ * in blocks: k-th term is the previous one times (k + c) v / (a + k), and terms are summed,
+ * until they are negligible in every element of the block
+ * @param v
+ * @param a
+ * @param c
+ * @param sum sum[i] = sum of terms for v[i]
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void ibetaPowerSeriesBlocks(const double *v, double a, double c, double *sum, size_t n)
+{
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    constexpr double TOLERANCE = MIN_POSITIVE;
+    double addon[BLOCK], total[BLOCK];
+    for (size_t start = 0; start != n; start += BLOCK) {
+        for (size_t j = 0; j != BLOCK; ++j) {
+            addon[j] = 1.0;
+            total[j] = 0.0;
+        }
+        int k = 1;
+        bool converged = false;
+        while (!converged) {
+            /// convergence is checked after every 4 terms
+            for (int kEnd = k + 4; k != kEnd; ++k) {
+                double coef = (k + c) / (a + k);
+                for (size_t j = 0; j != BLOCK; ++j) {
+                    addon[j] *= coef * v[start + j];
+                    total[j] += addon[j];
+                }
+            }
+            converged = true;
+            for (size_t j = 0; j != BLOCK; ++j)
+                converged &= !(std::fabs(addon[j]) > TOLERANCE * std::fabs(total[j]));
+        }
+        std::copy(total, total + BLOCK, sum + start);
+    }
+}
+
+/**
+ * @fn ibetaContinuedFraction1Blocks
+ * Equivalent continued fraction #1 in blocks
+ * @param x
+ * @param a
+ * @param b
+ * @param number
+ * @param ratio ratio[i] = F / (1 - F) for x[i]
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void ibetaContinuedFraction1Blocks(const double *x, double a, double b, int number, double *ratio, size_t n)
+{
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double u[BLOCK], frac[BLOCK];
+    double c1 = b / a;
+    for (size_t start = 0; start != n; start += BLOCK) {
+        for (size_t j = 0; j != BLOCK; ++j) {
+            u[j] = x[start + j] / (1.0 - x[start + j]);
+            frac[j] = 0.0;
+        }
+        for (int k = number; k > 1; --k) {
+            double coef = (b - k + 1) / (a + k - 1);
+            for (size_t j = 0; j != BLOCK; ++j) {
+                double cn = coef * u[j];
+                frac[j] = cn / (1 + cn - frac[j]);
+            }
+        }
+        for (size_t j = 0; j != BLOCK; ++j) {
+            double F = c1 / (1 + c1 - frac[j]);
+            ratio[start + j] = F / (1.0 - F);
+        }
+    }
+}
+
+/**
+ * @fn ibetaContinuedFraction2Blocks
+ * Equivalent continued fraction #2 in blocks
+ * @param x
+ * @param a
+ * @param b
+ * @param number
+ * @param ratio ratio[i] = F / (1 - F) for x[i]
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void ibetaContinuedFraction2Blocks(const double *x, double a, double b, int number, double *ratio, size_t n)
+{
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double frac[BLOCK];
+    double c1 = (a + b - 1) / a;
+    for (size_t start = 0; start != n; start += BLOCK) {
+        for (size_t j = 0; j != BLOCK; ++j)
+            frac[j] = 0.0;
+        for (int k = number; k > 1; --k) {
+            double coef = (a + b + k - 2) / (a + k - 1);
+            for (size_t j = 0; j != BLOCK; ++j) {
+                double cn = coef * x[start + j];
+                frac[j] = cn / (1 + cn - frac[j]);
+            }
+        }
+        for (size_t j = 0; j != BLOCK; ++j) {
+            double F = c1 / (1 + c1 - frac[j]);
+            ratio[start + j] = F / (1.0 - F);
+        }
+    }
+}
+
+/**
+ * @fn ibetaPowerSeriesTerm
+ * Adds exp(a log(x) + p log(1 - x) - log(B) + log(1 + sum)) / a to y
+ * @param a
+ * @param p
+ * @param logBetaFun
+ * @param logX
+ * @param log1mX
+ * @param sum sum of power series, it is overwritten
+ * @param y
+ * @param n
+ */
+void ibetaPowerSeriesTerm(double a, double p, double logBetaFun, const double *logX, const double *log1mX, double *sum, double *y, size_t n)
+{
+    vlog1p(sum, sum, n);
+    for (size_t i = 0; i != n; ++i)
+        sum[i] += a * logX[i] + p * log1mX[i] - logBetaFun;
+    vexp(sum, sum, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] += sum[i] / a;
+}
+
+/**
+ * @fn ibetaBlocks
+ * Regularized beta function for arguments, which are not reflected in scalar function (x <= a / (a + b))
+ * and are all either below or above 0.45
+ * @param x
+ * @param a
+ * @param b
+ * @param logBetaFun
+ * @param logX
+ * @param log1mX
+ * @param isSmall true if x < 0.45
+ * @param logBetaResidue log(B) of the residue after continued fraction, NaN until it is calculated
+ * @param y
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE, not greater than VECTOR_MATH_BUFFER_SIZE + VECTOR_MATH_BLOCK_SIZE
+ */
+void ibetaBlocks(const double *x, double a, double b, double logBetaFun, const double *logX, const double *log1mX,
+                 bool isSmall, double &logBetaResidue, double *y, size_t n)
+{
+    double v[VECTOR_MATH_BUFFER_SIZE + VECTOR_MATH_BLOCK_SIZE], z[VECTOR_MATH_BUFFER_SIZE + VECTOR_MATH_BLOCK_SIZE];
+    std::fill(y, y + n, 0.0);
+    double number = std::floor(b);
+    if (isSmall) {
+        for (size_t i = 0; i != n; ++i)
+            v[i] = -x[i] / (1.0 - x[i]);
+        if (b < 1) {
+            ibetaPowerSeriesBlocks(v, a, -b, z, n);
+            ibetaPowerSeriesTerm(a, b - 1, logBetaFun, logX, log1mX, z, y, n);
+            return;
+        }
+        /// equivalent continued fraction #1
+        ibetaContinuedFraction1Blocks(x, a, b, number, y, n);
+        for (size_t i = 0; i != n; ++i)
+            z[i] = a * logX[i] + (b - 1) * log1mX[i] - logBetaFun;
+        vexp(z, z, n);
+        for (size_t i = 0; i != n; ++i)
+            y[i] *= z[i] / b;
+        if (b == number)
+            return;
+        double apn = a + number, bmn = b - number;
+        if (std::isnan(logBetaResidue))
+            logBetaResidue = logBeta(apn, bmn);
+        ibetaPowerSeriesBlocks(v, apn, -bmn, z, n);
+        ibetaPowerSeriesTerm(apn, bmn - 1, logBetaResidue, logX, log1mX, z, y, n);
+        return;
+    }
+
+    if (b < 1) {
+        ibetaPowerSeriesBlocks(x, a, a + b - 1, z, n);
+        ibetaPowerSeriesTerm(a, b, logBetaFun, logX, log1mX, z, y, n);
+        return;
+    }
+    /// equivalent continued fraction #2
+    ibetaContinuedFraction2Blocks(x, a, b, number, y, n);
+    for (size_t i = 0; i != n; ++i)
+        z[i] = a * logX[i] + b * log1mX[i] - logBetaFun;
+    vexp(z, z, n);
+    for (size_t i = 0; i != n; ++i)
+        y[i] *= z[i] / (a + b - 1);
+    double apn = a + number;
+    if (std::isnan(logBetaResidue))
+        logBetaResidue = logBeta(apn, b);
+    ibetaPowerSeriesBlocks(x, apn, apn + b - 1, z, n);
+    ibetaPowerSeriesTerm(apn, b, logBetaResidue, logX, log1mX, z, y, n);
+}
+
+void ibeta(const double *x, double a, double b, double logBetaFun, const double *logX, const double *log1mX, double *y, size_t n)
+{
+    /// Check special and incorrect values of parameters
+    if (a <= 0 || b <= 0)
+        throw std::invalid_argument("Parameters (a, b) of incomplete beta function should be both positive, but they're equal to "
+                                    + std::to_string(a) + " and " + std::to_string(b) + " respectively");
+    for (size_t i = 0; i != n; ++i) {
+        if (x[i] < 0.0 || x[i] > 1.0)
+            throw std::invalid_argument("Argument x of incomplete beta function should be in interval [0, 1], but it's equal to "
+                                        + std::to_string(x[i]));
+    }
+    if (b == 1.0) {
+        for (size_t i = 0; i != n; ++i)
+            y[i] = a * logX[i];
+        vexp(y, y, n);
+        return;
+    }
+    if (a == 1.0) {
+        for (size_t i = 0; i != n; ++i)
+            y[i] = b * log1mX[i];
+        vexpm1(y, y, n);
+        for (size_t i = 0; i != n; ++i)
+            y[i] = -y[i];
+        return;
+    }
+
+    constexpr size_t SIZE = VECTOR_MATH_BUFFER_SIZE, BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    /// groups of arguments: x < 0.45, x >= 0.45, then the same for reflected 1 - x,
+    /// and the last one for 0, 1 and NaN, which go to the scalar function
+    static constexpr int GROUPS = 5, SCALAR = 4;
+    const double mean = a / (a + b);
+    /// log(B) of the residues, calculated once they are needed
+    double logBetaResidue[SCALAR] = {NAN, NAN, NAN, NAN};
+    int group[SIZE];
+    size_t order[SIZE];
+    double xs[SIZE + BLOCK], logXs[SIZE + BLOCK], log1mXs[SIZE + BLOCK], ys[SIZE + BLOCK];
+    for (size_t start = 0; start < n; start += SIZE) {
+        size_t size = std::min(SIZE, n - start);
+        const double *xc = x + start, *logXc = logX + start, *log1mXc = log1mX + start;
+        double *yc = y + start;
+
+        size_t groupStart[GROUPS + 1] = {};
+        for (size_t i = 0; i != size; ++i) {
+            double xi = xc[i];
+            if (!(xi > 0.0 && xi < 1.0))
+                group[i] = SCALAR;
+            /// If x is greater than mean of Beta distribution,
+            /// convergence of complementary distribution function is faster
+            else if (xi > mean)
+                group[i] = (1.0 - xi < 0.45) ? 2 : 3;
+            else
+                group[i] = (xi < 0.45) ? 0 : 1;
+            ++groupStart[group[i] + 1];
+        }
+        for (int g = 0; g != GROUPS; ++g)
+            groupStart[g + 1] += groupStart[g];
+        size_t groupEnd[GROUPS];
+        std::copy(groupStart, groupStart + GROUPS, groupEnd);
+        for (size_t i = 0; i != size; ++i)
+            order[groupEnd[group[i]]++] = i;
+
+        for (int g = 0; g != SCALAR; ++g) {
+            size_t begin = groupStart[g], m = groupStart[g + 1] - begin;
+            if (m == 0)
+                continue;
+            size_t padded = (m + BLOCK - 1) / BLOCK * BLOCK;
+            bool isReflected = (g >= 2), isSmall = (g % 2 == 0);
+            /// series run, until they converge in every element of the block,
+            /// hence arguments in the block should be close. Only continued fraction #1
+            /// with integer parameter has no series
+            double shape2 = isReflected ? a : b;
+            if (!isSmall || shape2 != std::floor(shape2))
+                std::sort(order + begin, order + begin + m, [xc] (size_t i, size_t j) { return xc[i] < xc[j]; });
+            for (size_t k = 0; k != m; ++k) {
+                size_t i = order[begin + k];
+                xs[k] = isReflected ? 1.0 - xc[i] : xc[i];
+                logXs[k] = isReflected ? log1mXc[i] : logXc[i];
+                log1mXs[k] = isReflected ? logXc[i] : log1mXc[i];
+            }
+            std::fill(xs + m, xs + padded, xs[0]);
+            std::fill(logXs + m, logXs + padded, logXs[0]);
+            std::fill(log1mXs + m, log1mXs + padded, log1mXs[0]);
+            if (isReflected) {
+                ibetaBlocks(xs, b, a, logBetaFun, logXs, log1mXs, isSmall, logBetaResidue[g], ys, padded);
+                for (size_t k = 0; k != m; ++k)
+                    ys[k] = 1.0 - ys[k];
+            }
+            else
+                ibetaBlocks(xs, a, b, logBetaFun, logXs, log1mXs, isSmall, logBetaResidue[g], ys, padded);
+            for (size_t k = 0; k != m; ++k)
+                yc[order[begin + k]] = ys[k];
+        }
+        for (size_t k = groupStart[SCALAR]; k != size; ++k) {
+            size_t i = order[k];
+            yc[i] = ibeta(xc[i], a, b, logBetaFun, logXc[i], log1mXc[i]);
+        }
+    }
+}
+
+void ibeta(const double *x, double a, double b, double *y, size_t n)
+{
+    double logBetaFun = logBeta(a, b);
+    double logX[VECTOR_MATH_BUFFER_SIZE], log1mX[VECTOR_MATH_BUFFER_SIZE];
+    for (size_t start = 0; start < n; start += VECTOR_MATH_BUFFER_SIZE) {
+        size_t size = std::min(VECTOR_MATH_BUFFER_SIZE, n - start);
+        for (size_t i = 0; i != size; ++i)
+            log1mX[i] = -x[start + i];
+        vlog(x + start, logX, size);
+        vlog1p(log1mX, log1mX, size);
+        ibeta(x + start, a, b, logBetaFun, logX, log1mX, y + start, size);
+    }
+}
+
 }
@@ -40,6 +40,34 @@ double ibeta(double x, double a, double b, double logBetaFun, double logX, doubl
  */
 double ibeta(double x, double a, double b);
 
+/**
+ * @fn ibeta
+ * Regularized beta function on array, using precalculated values.
+ * Arguments are grouped by the same methods as in scalar function: power series
+ * and equivalent continued fractions for x and for 1 - x, which are evaluated
+ * in blocks of RandMath::VECTOR_MATH_BLOCK_SIZE
+ * @param x
+ * @param a
+ * @param b
+ * @param logBetaFun log(B(a, b))
+ * @param logX logX[i] = log(x[i])
+ * @param log1mX log1mX[i] = log(1 - x[i])
+ * @param y y[i] = I(x[i], a, b)
+ * @param n
+ */
+void ibeta(const double *x, double a, double b, double logBetaFun, const double *logX, const double *log1mX, double *y, size_t n);
+
+/**
+ * @fn ibeta
+ * Regularized beta function on array
+ * @param x
+ * @param a
+ * @param b
+ * @param y y[i] = I(x[i], a, b)
+ * @param n
+ */
+void ibeta(const double *x, double a, double b, double *y, size_t n);
+
 }
 
 #endif // BETAMATH
@@ -1,4 +1,5 @@
 #include "GammaMath.h"
+#include "VectorMath.h"
 
 namespace RandMath
 {
@@ -473,12 +474,215 @@ double trigamma(double x)
     return y;
 }
 
+/**
+ * @fn isShiftedSeriesArgument
+ * @param x
+ * @return true if series after shift x + 10 are applicable:
+ * x is positive, normal and such that 1 / x is finite
+ */
+bool isShiftedSeriesArgument(double x)
+{
+    return x >= std::numeric_limits<double>::min() && x < INFINITY;
+}
+
+/**
+ * @fn isNearLgammaRoots
+ * @param x
+ * @return true if x is in [0.5, 3], where logarithm of the shift by 10 cancels out
+ * with Stirling series near the roots 1 and 2 and relative accuracy is lost
+ */
+bool isNearLgammaRoots(double x)
+{
+    return x >= 0.5 && x <= 3.0;
+}
+
+/// positive root of digamma function, split into the nearest double and the remainder
+static constexpr double DIGAMMA_ROOT_HI = 1.4616321449683622, DIGAMMA_ROOT_LO = 9.549995429965697e-17;
+
+/**
+ * @fn isNearDigammaRoot
+ * @param x
+ * @return true if x is closer than 0.25 to the positive root of digamma function
+ */
+bool isNearDigammaRoot(double x)
+{
+    return std::fabs(x - DIGAMMA_ROOT_HI) < 0.25;
+}
+
+/**
+ * @fn digammaNearRoot
+ * digamma(x) for |x - x0| < 0.25 by Taylor series around the positive root x0,
+ * which keep relative accuracy, when x is close to x0
+ * @param x
+ * @param y
+ * @param n
+ */
+void digammaNearRoot(const double *x, double *y, size_t n)
+{
+    /// polygamma(k, x0) / k! for k = 25, ..., 1
+    static constexpr double seriesCoef[] = {
+        5.178575795222081e-05, -7.569179582195066e-05, 0.0001106337276874741, -0.00016170622091974803,
+        0.00023635601564027053, -0.0003454680251063077, 0.000504953265834602, -0.0007380709389960052,
+        0.0010788252019162967, -0.0015769367714301972, 0.002305126326734928, -0.003369801655439328,
+        0.004926781395729853, -0.007204534386356869, 0.010538791616612175, -0.01542476590494896,
+        0.022597648232218104, -0.03316112647484736, 0.04880428816414311, -0.07219956125645471,
+        0.10782405069126237, -0.16394270544240652, 0.258499760955651, -0.4427631689835921,
+        0.9676722454476212
+    };
+    for (size_t j = 0; j != n; ++j) {
+        double t = (x[j] - DIGAMMA_ROOT_HI) - DIGAMMA_ROOT_LO;
+        double sum = seriesCoef[0];
+        for (size_t k = 1; k != sizeof(seriesCoef) / sizeof(*seriesCoef); ++k)
+            sum = sum * t + seriesCoef[k];
+        y[j] = sum * t;
+    }
+}
+
+void lgamma(const double *x, double *y, size_t n)
+{
+    /// B(2k) / (2k (2k - 1)) for k = 7, ..., 1
+    static constexpr double stirlingCoef[] = {
+        1.0 / 156, -691.0 / 360360, 1.0 / 1188, -1.0 / 1680, 1.0 / 1260, -1.0 / 360, 1.0 / 12
+    };
+    static constexpr double MAX_X = 1e30; ///< product of 10 shifted arguments doesn't overflow
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double z[BLOCK], product[BLOCK], logZ[BLOCK], r[BLOCK], rSq[BLOCK], series[BLOCK];
+    for (size_t start = 0; start < n; start += BLOCK) {
+        size_t size = std::min(BLOCK, n - start);
+        for (size_t j = 0; j != BLOCK; ++j)
+            z[j] = (j < size && isShiftedSeriesArgument(x[start + j]) && x[start + j] < MAX_X) ? x[start + j] : 1.0;
+        /// Γ(z) = Γ(z + 10) / (z (z + 1) ... (z + 9))
+        for (size_t j = 0; j != BLOCK; ++j)
+            product[j] = z[j];
+        for (int k = 1; k != 10; ++k) {
+            for (size_t j = 0; j != BLOCK; ++j)
+                product[j] *= z[j] + k;
+        }
+        for (size_t j = 0; j != BLOCK; ++j)
+            z[j] += 10.0;
+        vlog(z, logZ, BLOCK);
+        vlog(product, product, BLOCK);
+        for (size_t j = 0; j != BLOCK; ++j) {
+            r[j] = 1.0 / z[j];
+            rSq[j] = r[j] * r[j];
+            series[j] = stirlingCoef[0];
+        }
+        for (int k = 1; k != 7; ++k) {
+            for (size_t j = 0; j != BLOCK; ++j)
+                series[j] = series[j] * rSq[j] + stirlingCoef[k];
+        }
+        for (size_t j = 0; j != BLOCK; ++j) {
+            double stirling = (z[j] - 0.5) * logZ[j] - z[j] + 0.5 * (M_LN2 + M_LNPI);
+            logZ[j] = stirling + series[j] * r[j] - product[j];
+        }
+        for (size_t j = 0; j != size; ++j) {
+            double xj = x[start + j];
+            bool isShifted = isShiftedSeriesArgument(xj) && xj < MAX_X && !isNearLgammaRoots(xj);
+            y[start + j] = isShifted ? logZ[j] : std::lgamma(xj);
+        }
+    }
+}
+
+void digamma(const double *x, double *y, size_t n)
+{
+    /// B(2k) / 2k for k = 8, ..., 1
+    static constexpr double asymptoticCoef[] = {
+        -3617.0 / 8160, 1.0 / 12, -691.0 / 32760, 1.0 / 132, -1.0 / 240, 1.0 / 252, -1.0 / 120, 1.0 / 12
+    };
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double z[BLOCK], shift[BLOCK], logZ[BLOCK], r[BLOCK], rSq[BLOCK], series[BLOCK];
+    double nearRootX[BLOCK], nearRootY[BLOCK];
+    size_t nearRoot[BLOCK];
+    for (size_t start = 0; start < n; start += BLOCK) {
+        size_t size = std::min(BLOCK, n - start);
+        for (size_t j = 0; j != BLOCK; ++j)
+            z[j] = (j < size && isShiftedSeriesArgument(x[start + j])) ? x[start + j] : 1.0;
+        /// digamma(z) = digamma(z + 10) - 1 / z - 1 / (z + 1) - ... - 1 / (z + 9)
+        for (size_t j = 0; j != BLOCK; ++j)
+            shift[j] = 0.0;
+        for (int k = 0; k != 10; ++k) {
+            for (size_t j = 0; j != BLOCK; ++j)
+                shift[j] += 1.0 / (z[j] + k);
+        }
+        for (size_t j = 0; j != BLOCK; ++j)
+            z[j] += 10.0;
+        vlog(z, logZ, BLOCK);
+        for (size_t j = 0; j != BLOCK; ++j) {
+            r[j] = 1.0 / z[j];
+            rSq[j] = r[j] * r[j];
+            series[j] = asymptoticCoef[0];
+        }
+        for (int k = 1; k != 8; ++k) {
+            for (size_t j = 0; j != BLOCK; ++j)
+                series[j] = series[j] * rSq[j] + asymptoticCoef[k];
+        }
+        for (size_t j = 0; j != BLOCK; ++j)
+            logZ[j] -= 0.5 * r[j] + series[j] * rSq[j] + shift[j];
+        for (size_t j = 0; j != size; ++j) {
+            double xj = x[start + j];
+            y[start + j] = isShiftedSeriesArgument(xj) ? logZ[j] : digamma(xj);
+        }
+
+        /// arguments near the root are collected and recalculated by series
+        size_t nearRootNum = 0;
+        for (size_t j = 0; j != size; ++j) {
+            if (isNearDigammaRoot(x[start + j])) {
+                nearRootX[nearRootNum] = x[start + j];
+                nearRoot[nearRootNum++] = start + j;
+            }
+        }
+        digammaNearRoot(nearRootX, nearRootY, nearRootNum);
+        for (size_t j = 0; j != nearRootNum; ++j)
+            y[nearRoot[j]] = nearRootY[j];
+    }
+}
+
+void trigamma(const double *x, double *y, size_t n)
+{
+    /// B(2k) for k = 8, ..., 1
+    static constexpr double asymptoticCoef[] = {
+        -3617.0 / 510, 7.0 / 6, -691.0 / 2730, 5.0 / 66, -1.0 / 30, 1.0 / 42, -1.0 / 30, 1.0 / 6
+    };
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double z[BLOCK], shift[BLOCK], r[BLOCK], rSq[BLOCK], series[BLOCK];
+    for (size_t start = 0; start < n; start += BLOCK) {
+        size_t size = std::min(BLOCK, n - start);
+        for (size_t j = 0; j != BLOCK; ++j)
+            z[j] = (j < size && isShiftedSeriesArgument(x[start + j])) ? x[start + j] : 1.0;
+        /// trigamma(z) = trigamma(z + 10) + 1 / z^2 + 1 / (z + 1)^2 + ... + 1 / (z + 9)^2
+        for (size_t j = 0; j != BLOCK; ++j)
+            shift[j] = 0.0;
+        for (int k = 0; k != 10; ++k) {
+            for (size_t j = 0; j != BLOCK; ++j) {
+                double inv = 1.0 / (z[j] + k);
+                shift[j] += inv * inv;
+            }
+        }
+        for (size_t j = 0; j != BLOCK; ++j) {
+            r[j] = 1.0 / (z[j] + 10.0);
+            rSq[j] = r[j] * r[j];
+            series[j] = asymptoticCoef[0];
+        }
+        for (int k = 1; k != 8; ++k) {
+            for (size_t j = 0; j != BLOCK; ++j)
+                series[j] = series[j] * rSq[j] + asymptoticCoef[k];
+        }
+        for (size_t j = 0; j != BLOCK; ++j)
+            shift[j] += r[j] + 0.5 * rSq[j] + series[j] * rSq[j] * r[j];
+        for (size_t j = 0; j != size; ++j) {
+            double xj = x[start + j];
+            y[start + j] = isShiftedSeriesArgument(xj) ? shift[j] : trigamma(xj);
+        }
+    }
+}
+
 enum REGULARISED_GAMMA_METHOD_ID {
     PT,
     QT,
     PUA,
     QUA,
     CF,
+    EXP, ///< a = 1, used only by functions on arrays
     UNDEFINED
 };
 
@@ -501,7 +705,7 @@ REGULARISED_GAMMA_METHOD_ID getRegularizedGammaMethodId(double a, double x, doub
     return (a > alpha) ? PUA : QUA;
 }
 
-double incompleteGammaUniformExpansion(double a, double x, double logX, double logA, bool isP)
+double incompleteGammaUniformExpansion(double a, double x, double logA, bool isP)
 {
     /// Uniform asymptotic expansion for P(a, x) if isP == true, or Q(a, x) otherwise
     static constexpr long double d[] = {-0.33333333333333333333l, 0.08333333333333333333l, -0.01481481481481481481l, 0.00115740740740740741l,
@@ -512,19 +716,24 @@ double incompleteGammaUniformExpansion(double a, double x, double logX, double l
                                          0.337176326240099e-12l, -0.139238872241816e-12l, 0.285348938070474e-13l, -0.513911183424242e-15l,
                                         -0.197522882943494428e-16l, 0.809952115670456133e-17};
     static constexpr int N = 25;
-    double lambda = x / a;
-    double logLambda = logX - logA;
+    /// log(x / a) = log1p((x - a) / a) keeps digits for x ~ a,
+    /// where only the difference with x / a - 1 is left
+    double lambdam1 = (x - a) / a;
+    double logLambda = std::log1p(lambdam1);
     double aux = x - a - a * logLambda;
     double eta = 0.0, base = 0.5;
     if (aux > 0.0) { /// otherwise, x ~ a and aux ~ 0.0
-        eta = std::sqrt(2 * (lambda - 1.0 - logLambda));
+        eta = std::sqrt(2 * (lambdam1 - logLambda));
+        /// eta has the sign of x - a, coefficients beta don't depend on it
+        if (x < a)
+            eta = -eta;
         base = 0.5 * std::erfc(std::sqrt(aux));
     }
     long double sum = 0.0l;
     double betanp2 = d[N], betanp1 = d[N - 1];
     for (int n = N - 2; n >= 0; --n) {
         double beta = (n + 2) * betanp2 / a;
-        beta += (x < a && (n & 1)) ? -d[n] : d[n];
+        beta += d[n];
         sum += beta * std::pow(eta, n);
         betanp2 = betanp1;
         betanp1 = beta;
@@ -568,7 +777,7 @@ double lpgamma(double a, double x, double logA, double lgammaA)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 0.0;
+        return -INFINITY;
     if (a == 1.0)
         return RandMath::log1mexp(-x);
     double logX = std::log(x);
@@ -580,7 +789,7 @@ double lpgamma(double a, double x, double logX)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 0.0;
+        return -INFINITY;
     if (a == 1.0)
         return RandMath::log1mexp(-x);
     REGULARISED_GAMMA_METHOD_ID mId = getRegularizedGammaMethodId(a, x, logX);
@@ -591,7 +800,7 @@ double lpgamma(double a, double x)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 0.0;
+        return -INFINITY;
     if (a == 1.0)
         return RandMath::log1mexp(-x);
     double logX = std::log(x);
@@ -604,7 +813,7 @@ double pgammaRaw(double a, double x, double logX, double logA, double lgammaA, R
     if (mId == PT)
         return std::exp(lpgammaRaw(a, x, logX, logA, lgammaA, mId));
     if (mId == PUA)
-        return incompleteGammaUniformExpansion(a, x, logX, logA, true);
+        return incompleteGammaUniformExpansion(a, x, logA, true);
     return (mId == QUA) ? 1.0 - qgammaRaw(a, x, logX, logA, lgammaA, mId) :
                           -std::expm1l(lqgammaRaw(a, x, logX, logA, lgammaA, mId));
 }
@@ -613,7 +822,7 @@ double pgamma(double a, double x, double logA, double lgammaA)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 1.0;
+        return 0.0;
     if (a == 1.0)
         return -std::expm1l(-x);
     double logX = std::log(x);
@@ -625,7 +834,7 @@ double pgamma(double a, double x, double logX)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 1.0;
+        return 0.0;
     if (a == 1.0)
         return -std::expm1l(-x);
     REGULARISED_GAMMA_METHOD_ID mId = getRegularizedGammaMethodId(a, x, logX);
@@ -636,7 +845,7 @@ double pgamma(double a, double x)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 1.0;
+        return 0.0;
     if (a == 1.0)
         return -std::expm1l(-x);
     double logX = std::log(x);
@@ -701,7 +910,7 @@ double lqgamma(double a, double x, double logA, double lgammaA)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return -INFINITY;
+        return 0.0;
     if (a == 1.0)
         return -x;
     double logX = std::log(x);
@@ -713,7 +922,7 @@ double lqgamma(double a, double x, double logX)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return -INFINITY;
+        return 0.0;
     if (a == 1.0)
         return -x;
     REGULARISED_GAMMA_METHOD_ID mId = getRegularizedGammaMethodId(a, x, logX);
@@ -724,7 +933,7 @@ double lqgamma(double a, double x)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return -INFINITY;
+        return 0.0;
     if (a == 1.0)
         return -x;
     double logX = std::log(x);
@@ -739,7 +948,7 @@ double qgammaRaw(double a, double x, double logX, double logA, double lgammaA, R
     if (mId == QT)
         return -std::expm1l(qtGammaExpansionAux(a, logX, logA, lgammaA));
     if (mId == QUA)
-        return incompleteGammaUniformExpansion(a, x, logX, logA, false);
+        return incompleteGammaUniformExpansion(a, x, logA, false);
     return (mId == PUA) ? 1.0 - pgammaRaw(a, x, logX, logA, lgammaA, mId) :
                           -std::expm1l(lpgammaRaw(a, x, logX, logA, lgammaA, mId));
 }
@@ -748,7 +957,7 @@ double qgamma(double a, double x, double logA, double lgammaA)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 0.0;
+        return 1.0;
     if (a == 1.0)
         return std::exp(-x);
     double logX = std::log(x);
@@ -760,7 +969,7 @@ double qgamma(double a, double x, double logX)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 0.0;
+        return 1.0;
     if (a == 1.0)
         return std::exp(-x);
     REGULARISED_GAMMA_METHOD_ID mId = getRegularizedGammaMethodId(a, x, logX);
@@ -771,7 +980,7 @@ double qgamma(double a, double x)
 {
     parametersVerification(a, x);
     if (x == 0.0)
-        return 0.0;
+        return 1.0;
     if (a == 1.0)
         return std::exp(-x);
     double logX = std::log(x);
@@ -779,5 +988,310 @@ double qgamma(double a, double x)
     return qgammaRaw(a, x, logX, std::log(a), std::lgammal(a), mId);
 }
 
+/**
+ * @fn lpgammaSeriesBlocks
+ * Taylor expansion of log(P(a, x)) in blocks: terms are summed up to the longest expansion in the block
+ * @param a
+ * @param x
+ * @param logX
+ * @param lgammaAp1 log(Γ(a + 1))
+ * @param y
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void lpgammaSeriesBlocks(double a, const double *x, const double *logX, double lgammaAp1, double *y, size_t n)
+{
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double term[BLOCK], sum[BLOCK];
+    for (size_t start = 0; start != n; start += BLOCK) {
+        int n0 = 0;
+        for (size_t j = 0; j != BLOCK; ++j)
+            n0 = std::max(n0, static_cast<int>(70.0 * x[start + j] / a + 7));
+        for (size_t j = 0; j != BLOCK; ++j) {
+            term[j] = 1.0;
+            sum[j] = 0.0;
+        }
+        /// n-th term is x^n / ((a + 1) ... (a + n))
+        for (int k = 1; k <= n0; ++k) {
+            double coef = 1.0 / (a + k);
+            for (size_t j = 0; j != BLOCK; ++j) {
+                term[j] *= x[start + j] * coef;
+                sum[j] += term[j];
+            }
+        }
+        vlog1p(sum, sum, BLOCK);
+        for (size_t j = 0; j != BLOCK; ++j)
+            y[start + j] = a * logX[start + j] - x[start + j] + sum[j] - lgammaAp1;
+    }
+}
+
+/**
+ * @fn lpgammaQtBlocks
+ * Logarithm of 1 - Q(a, x), calculated by Taylor expansion of Q(a, x), in blocks
+ * @param a
+ * @param x
+ * @param logX
+ * @param logA
+ * @param lgammaA
+ * @param y
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void lpgammaQtBlocks(double a, const double *x, const double *logX, double logA, double lgammaA, double *y, size_t n)
+{
+    /// the same 19 terms as in qtGammaExpansionAux, summed by Horner scheme:
+    /// n-th term is (-x)^n / (n! (a + n))
+    static constexpr int DEGREE = 19;
+    double coef[DEGREE + 1];
+    for (int k = 1; k <= DEGREE; ++k)
+        coef[k] = std::exp(-lfact(k)) / (a + k);
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double sum[BLOCK];
+    for (size_t start = 0; start != n; start += BLOCK) {
+        for (size_t j = 0; j != BLOCK; ++j)
+            sum[j] = coef[DEGREE];
+        for (int k = DEGREE - 1; k > 0; --k) {
+            for (size_t j = 0; j != BLOCK; ++j)
+                sum[j] = coef[k] - x[start + j] * sum[j];
+        }
+        for (size_t j = 0; j != BLOCK; ++j)
+            sum[j] *= -a * x[start + j];
+        vlog1p(sum, sum, BLOCK);
+        for (size_t j = 0; j != BLOCK; ++j)
+            y[start + j] = sum[j] + a * logX[start + j] - logA - lgammaA;
+    }
+}
+
+/**
+ * @fn lqgammaFractionBlocks
+ * Continued fraction for log(Q(a, x)) in blocks: terms are summed up to the longest fraction in the block
+ * @param a
+ * @param x
+ * @param logX
+ * @param lgammaA
+ * @param y
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void lqgammaFractionBlocks(double a, const double *x, const double *logX, double lgammaA, double *y, size_t n)
+{
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double rho[BLOCK], t[BLOCK], sum[BLOCK], xma[BLOCK];
+    for (size_t start = 0; start != n; start += BLOCK) {
+        int k0 = 0;
+        for (size_t j = 0; j != BLOCK; ++j)
+            k0 = std::max(k0, static_cast<int>(std::min(40.0 / (x[start + j] - 1) + 5.0, 60.0)));
+        for (size_t j = 0; j != BLOCK; ++j) {
+            rho[j] = 0.0;
+            t[j] = 1.0;
+            sum[j] = 0.0;
+        }
+        for (int k = 1; k <= k0; ++k) {
+            double akNumerator = k * (a - k);
+            for (size_t j = 0; j != BLOCK; ++j) {
+                double temp = x[start + j] + 2 * k - a;
+                double ak = akNumerator / (temp * temp - 1);
+                double r = (rho[j] + 1) * ak;
+                rho[j] = r / -(1 + r);
+                t[j] *= rho[j];
+                sum[j] += t[j];
+            }
+        }
+        for (size_t j = 0; j != BLOCK; ++j)
+            xma[j] = x[start + j] - a;
+        vlog1p(sum, sum, BLOCK);
+        vlog1p(xma, xma, BLOCK);
+        for (size_t j = 0; j != BLOCK; ++j)
+            y[start + j] = sum[j] + a * logX[start + j] - x[start + j] - lgammaA - xma[j];
+    }
+}
+
+/**
+ * @fn incompleteGammaUniformExpansionBlocks
+ * Uniform asymptotic expansion in blocks, for all x < a (P(a, x)) or for all x > a (Q(a, x))
+ * @param a
+ * @param x
+ * @param logA
+ * @param isP
+ * @param y
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void incompleteGammaUniformExpansionBlocks(double a, const double *x, double logA, bool isP, double *y, size_t n)
+{
+    /// coefficients beta(n) of incompleteGammaUniformExpansion depend only on a
+    static constexpr long double d[] = {-0.33333333333333333333l, 0.08333333333333333333l, -0.01481481481481481481l, 0.00115740740740740741l,
+                                         0.00035273368606701940l, -0.000178755144032922l, 0.0000391926317852244l, -0.00000218544851067999l,
+                                        -0.00000185406221071516l, 0.829671134095309e-6l, -0.176659527368261e-6l, 0.670785354340150e-8l,
+                                         0.102618097842403e-7l, -0.438203601845335e-8l, 0.914769958223678e-9l, -0.255141939949460e-10l,
+                                        -0.583077213255043e-10l, 0.243619480206674e-10l, -0.502766928011417e-11l, 0.110043920319559e-12l,
+                                         0.337176326240099e-12l, -0.139238872241816e-12l, 0.285348938070474e-13l, -0.513911183424242e-15l,
+                                        -0.197522882943494428e-16l, 0.809952115670456133e-17};
+    static constexpr int N = 25;
+    double beta[N - 1];
+    double betanp2 = d[N], betanp1 = d[N - 1];
+    for (int k = N - 2; k >= 0; --k) {
+        beta[k] = (k + 2) * betanp2 / a;
+        beta[k] += d[k];
+        betanp2 = betanp1;
+        betanp1 = beta[k];
+    }
+    /// P is base minus the sum, Q is base plus the sum
+    double factor = isP ? -a / (a + betanp2) : a / (a + betanp2);
+    double zShift = 0.5 * (M_LN2 + M_LNPI + logA);
+
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double eta[BLOCK], base[BLOCK], z[BLOCK], sum[BLOCK], lambdam1[BLOCK], logLambda[BLOCK];
+    for (size_t start = 0; start != n; start += BLOCK) {
+        /// log(x / a) as in incompleteGammaUniformExpansion
+        for (size_t j = 0; j != BLOCK; ++j)
+            lambdam1[j] = (x[start + j] - a) / a;
+        vlog1p(lambdam1, logLambda, BLOCK);
+        /// erfc has no vector version, this loop stays scalar
+        for (size_t j = 0; j != BLOCK; ++j) {
+            double aux = x[start + j] - a - a * logLambda[j];
+            eta[j] = 0.0;
+            base[j] = 0.5;
+            if (aux > 0.0) {
+                eta[j] = std::sqrt(2 * (lambdam1[j] - logLambda[j]));
+                eta[j] = isP ? -eta[j] : eta[j];
+                base[j] = 0.5 * std::erfc(std::sqrt(aux));
+            }
+            z[j] = -aux - zShift;
+        }
+        vexp(z, z, BLOCK);
+        for (size_t j = 0; j != BLOCK; ++j)
+            sum[j] = beta[N - 2];
+        for (int k = N - 3; k >= 0; --k) {
+            for (size_t j = 0; j != BLOCK; ++j)
+                sum[j] = sum[j] * eta[j] + beta[k];
+        }
+        for (size_t j = 0; j != BLOCK; ++j)
+            y[start + j] = base[j] + z[j] * sum[j] * factor;
+    }
+}
+
+/**
+ * @fn regularizedGammaArray
+ * @param a
+ * @param x
+ * @param logA
+ * @param lgammaA
+ * @param y y[i] = P(a, x[i]) if isP is true, Q(a, x[i]) otherwise
+ * @param n
+ * @param isP
+ */
+void regularizedGammaArray(double a, const double *x, double logA, double lgammaA, double *y, size_t n, bool isP)
+{
+    parametersVerification(a, 0.0);
+    for (size_t i = 0; i != n; ++i) {
+        if (x[i] < 0.0)
+            parametersVerification(a, x[i]);
+    }
+    constexpr size_t SIZE = VECTOR_MATH_BUFFER_SIZE, BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double logX[SIZE];
+    REGULARISED_GAMMA_METHOD_ID mId[SIZE];
+    size_t order[SIZE];
+    /// arguments of one method, padded to whole blocks
+    double xs[SIZE + BLOCK], logXs[SIZE + BLOCK], ys[SIZE + BLOCK];
+    for (size_t start = 0; start < n; start += SIZE) {
+        size_t size = std::min(SIZE, n - start);
+        const double *xc = x + start;
+        double *yc = y + start;
+        for (size_t i = 0; i != size; ++i)
+            logX[i] = (xc[i] > 0.0) ? xc[i] : 1.0;
+        vlog(logX, logX, size);
+
+        /// sort indices by method: zero, infinite and NaN arguments go to the scalar function
+        size_t groupStart[UNDEFINED + 2] = {};
+        for (size_t i = 0; i != size; ++i) {
+            double xi = xc[i];
+            if (!(xi > 0.0) || xi == INFINITY)
+                mId[i] = UNDEFINED;
+            else
+                mId[i] = (a == 1.0) ? EXP : getRegularizedGammaMethodId(a, xi, logX[i]);
+            ++groupStart[mId[i] + 1];
+        }
+        for (int g = 0; g <= UNDEFINED; ++g)
+            groupStart[g + 1] += groupStart[g];
+        size_t groupEnd[UNDEFINED + 1];
+        std::copy(groupStart, groupStart + UNDEFINED + 1, groupEnd);
+        for (size_t i = 0; i != size; ++i)
+            order[groupEnd[mId[i]]++] = i;
+
+        for (int g = PT; g != UNDEFINED; ++g) {
+            size_t begin = groupStart[g], m = groupStart[g + 1] - begin;
+            if (m == 0)
+                continue;
+            size_t padded = (m + BLOCK - 1) / BLOCK * BLOCK;
+            for (size_t k = 0; k != m; ++k) {
+                xs[k] = xc[order[begin + k]];
+                logXs[k] = logX[order[begin + k]];
+            }
+            std::fill(xs + m, xs + padded, xs[0]);
+            std::fill(logXs + m, logXs + padded, logXs[0]);
+            /// PT and QT give log(P), CF and EXP give log(Q), PUA and QUA give P and Q
+            bool isLogP = false, isLog = true;
+            switch (g) {
+            case PT:
+                lpgammaSeriesBlocks(a, xs, logXs, logA + lgammaA, ys, padded);
+                isLogP = true;
+                break;
+            case QT:
+                lpgammaQtBlocks(a, xs, logXs, logA, lgammaA, ys, padded);
+                isLogP = true;
+                break;
+            case CF:
+                lqgammaFractionBlocks(a, xs, logXs, lgammaA, ys, padded);
+                break;
+            case EXP:
+                for (size_t k = 0; k != padded; ++k)
+                    ys[k] = -xs[k];
+                break;
+            default:
+                incompleteGammaUniformExpansionBlocks(a, xs, logA, g == PUA, ys, padded);
+                isLogP = (g == PUA);
+                isLog = false;
+                break;
+            }
+            if (!isLog) {
+                if (isLogP != isP) {
+                    for (size_t k = 0; k != m; ++k)
+                        ys[k] = 1.0 - ys[k];
+                }
+            }
+            else if (isLogP == isP)
+                vexp(ys, ys, m);
+            else {
+                vexpm1(ys, ys, m);
+                for (size_t k = 0; k != m; ++k)
+                    ys[k] = -ys[k];
+            }
+            for (size_t k = 0; k != m; ++k)
+                yc[order[begin + k]] = ys[k];
+        }
+        for (size_t k = groupStart[UNDEFINED]; k != size; ++k) {
+            size_t i = order[k];
+            yc[i] = isP ? pgamma(a, xc[i], logA, lgammaA) : qgamma(a, xc[i], logA, lgammaA);
+        }
+    }
+}
+
+void pgamma(double a, const double *x, double logA, double lgammaA, double *y, size_t n)
+{
+    regularizedGammaArray(a, x, logA, lgammaA, y, n, true);
+}
+
+void pgamma(double a, const double *x, double *y, size_t n)
+{
+    regularizedGammaArray(a, x, std::log(a), std::lgammal(a), y, n, true);
+}
+
+void qgamma(double a, const double *x, double logA, double lgammaA, double *y, size_t n)
+{
+    regularizedGammaArray(a, x, logA, lgammaA, y, n, false);
+}
+
+void qgamma(double a, const double *x, double *y, size_t n)
+{
+    regularizedGammaArray(a, x, std::log(a), std::lgammal(a), y, n, false);
+}
+
 
 }
@@ -71,6 +71,43 @@ double digammamLog(double x);
  */
 double trigamma(double x);
 
+/// Functions on arrays below compute y[i] = f(x[i]) for i = 0, ..., n - 1.
+/// Arguments are split by the method of evaluation, and each group is evaluated
+/// in blocks of RandMath::VECTOR_MATH_BLOCK_SIZE by series of fixed length
+/// and elementary functions of VectorMath.h. Arguments, which none of these methods covers,
+/// are passed to scalar functions
+
+/**
+ * @fn lgamma
+ * Logarithm of gamma function on array: Stirling series after shift x + 10
+ * for 0 < x < 1e30 out of [0.5, 3], std::lgamma otherwise. Near the roots 1 and 2
+ * Stirling series and logarithm of the shift cancel out, hence they are left to std::lgamma.
+ * Error is below 2e-14 in absolute terms for x < 10 and about 1e-15 in relative terms for larger x
+ * @param x
+ * @param y y[i] = log(|Γ(x[i])|)
+ * @param n
+ */
+void lgamma(const double *x, double *y, size_t n);
+
+/**
+ * @fn digamma
+ * Digamma function on array: asymptotic series after shift x + 10 for positive x,
+ * Taylor series around the positive root x0 for |x - x0| < 0.25, which keep relative accuracy there
+ * @param x
+ * @param y y[i] = digamma(x[i])
+ * @param n
+ */
+void digamma(const double *x, double *y, size_t n);
+
+/**
+ * @fn trigamma
+ * Trigamma function on array: asymptotic series after shift x + 10 for positive x
+ * @param x
+ * @param y y[i] = trigamma(x[i])
+ * @param n
+ */
+void trigamma(const double *x, double *y, size_t n);
+
 /**
  * @fn lpgamma
  * Calculate logarithm of lower incomplete gamma function,
@@ -198,6 +235,54 @@ double qgamma(double a, double x, double logX);
  * @return Q(a, x)
  */
 double qgamma(double a, double x);
+
+/**
+ * @fn pgamma
+ * Lower regularized incomplete gamma function on array,
+ * accelerated by using precalculated value of log(a) and log(Γ(a)).
+ * Arguments are grouped by the same regions as in scalar function: Taylor expansions of P and Q,
+ * continued fraction and uniform asymptotic expansion
+ * @param a non-negative parameter
+ * @param x non-negative arguments
+ * @param logA log(a)
+ * @param lgammaA log(Γ(a))
+ * @param y y[i] = P(a, x[i])
+ * @param n
+ */
+void pgamma(double a, const double *x, double logA, double lgammaA, double *y, size_t n);
+
+/**
+ * @fn pgamma
+ * Lower regularized incomplete gamma function on array
+ * @param a non-negative parameter
+ * @param x non-negative arguments
+ * @param y y[i] = P(a, x[i])
+ * @param n
+ */
+void pgamma(double a, const double *x, double *y, size_t n);
+
+/**
+ * @fn qgamma
+ * Upper regularized incomplete gamma function on array,
+ * accelerated by using precalculated value of log(a) and log(Γ(a))
+ * @param a non-negative parameter
+ * @param x non-negative arguments
+ * @param logA log(a)
+ * @param lgammaA log(Γ(a))
+ * @param y y[i] = Q(a, x[i])
+ * @param n
+ */
+void qgamma(double a, const double *x, double logA, double lgammaA, double *y, size_t n);
+
+/**
+ * @fn qgamma
+ * Upper regularized incomplete gamma function on array
+ * @param a non-negative parameter
+ * @param x non-negative arguments
+ * @param y y[i] = Q(a, x[i])
+ * @param n
+ */
+void qgamma(double a, const double *x, double *y, size_t n);
 }
 
 #endif // GAMMAMATH
@@ -2,23 +2,347 @@
 #define NUMERICMATH
 
 #include "RandMath.h"
+#include <type_traits>
 
 /// Numerical procedures
 
 namespace RandMath
 {
 
+/**
+ * @fn gaussKronrodRule
+ * Gauss-Kronrod rule G7K15 on interval [a, b]
+ * @param fun integrand
+ * @param a lower boundary
+ * @param b upper boundary
+ * @param error estimate of absolute error: difference of 15-point Kronrod and 7-point Gauss rules,
+ * scaled as in QUADPACK
+ * @return integral by 15-point Kronrod rule
+ */
+template <class Function>
+double gaussKronrodRule(const Function &fun, double a, double b, double &error)
+{
+    /// nodes of Kronrod rule in descending order (odd ones are nodes of Gauss rule), the last one is 0
+    static constexpr double XGK[8] = {0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+                                      0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+                                      0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+                                      0.207784955007898467600689403773245, 0.0};
+    static constexpr double WGK[8] = {0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+                                      0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+                                      0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+                                      0.204432940075298892414161999234649, 0.209482141084727828012999174891714};
+    static constexpr double WG[4] = {0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+                                     0.381830050505118944950369775488975, 0.417959183673469387755102040816327};
+    static constexpr double EPS = std::numeric_limits<double>::epsilon();
+    double center = 0.5 * (a + b), halfLength = 0.5 * (b - a);
+    double fc = fun(center);
+    double resultG = WG[3] * fc, resultK = WGK[7] * fc, resultAbs = std::fabs(resultK);
+    double f1[7], f2[7];
+    for (int i = 0; i != 7; ++i) {
+        double abscissa = halfLength * XGK[i];
+        f1[i] = fun(center - abscissa);
+        f2[i] = fun(center + abscissa);
+        double sum = f1[i] + f2[i];
+        resultK += WGK[i] * sum;
+        resultAbs += WGK[i] * (std::fabs(f1[i]) + std::fabs(f2[i]));
+        if (i % 2 == 1)
+            resultG += WG[i / 2] * sum;
+    }
+    /// integral of |f - mean| shows, how much the difference of the rules overestimates the error
+    double mean = 0.5 * resultK;
+    double resultAsc = WGK[7] * std::fabs(fc - mean);
+    for (int i = 0; i != 7; ++i)
+        resultAsc += WGK[i] * (std::fabs(f1[i] - mean) + std::fabs(f2[i] - mean));
+    double absHalfLength = std::fabs(halfLength);
+    resultAbs *= absHalfLength;
+    resultAsc *= absHalfLength;
+    error = std::fabs((resultK - resultG) * halfLength);
+    if (resultAsc != 0.0 && error != 0.0)
+        error = resultAsc * std::min(1.0, std::pow(200 * error / resultAsc, 1.5));
+    if (resultAbs > std::numeric_limits<double>::min() / (50 * EPS))
+        error = std::max(50 * EPS * resultAbs, error);
+    return resultK * halfLength;
+}
+
+/**
+ * @fn gaussKronrodIntegral
+ * Globally adaptive Gauss-Kronrod quadrature: interval with the largest error is bisected,
+ * until the sum of errors is below the tolerance. The initial interval is always bisected,
+ * since the error estimate of a single rule is unreliable, when the integrand is concentrated
+ * near a boundary. Intervals are kept on the stack, integrand is never evaluated at the boundaries
+ * @param fun integrand
+ * @param a lower boundary
+ * @param b upper boundary
+ * @param error estimate of absolute error in output
+ * @param epsilon absolute tolerance
+ * @param maxRecursionDepth how many times an interval can be bisected
+ * @return
+ */
+template <class Function>
+double gaussKronrodIntegral(const Function &fun, double a, double b, double &error,
+                            double epsilon = 1e-11, int maxRecursionDepth = 11)
+{
+    static constexpr int MAX_INTERVALS = 128;
+    static constexpr double EPS = std::numeric_limits<double>::epsilon();
+    struct Interval
+    {
+        double a, b, value, error;
+        int depth;
+    };
+    Interval intervals[MAX_INTERVALS];
+    intervals[0] = {a, b, 0.0, 0.0, 0};
+    intervals[0].value = gaussKronrodRule(fun, a, b, intervals[0].error);
+    int size = 1;
+    double value = intervals[0].value;
+    error = intervals[0].error;
+    /// tolerance can't be smaller than rounding errors
+    while ((size == 1 || error > std::max(epsilon, 50 * EPS * std::fabs(value))) && size < MAX_INTERVALS) {
+        int worst = -1;
+        for (int i = 0; i != size; ++i) {
+            if (intervals[i].depth < maxRecursionDepth && (worst < 0 || intervals[i].error > intervals[worst].error))
+                worst = i;
+        }
+        if (worst < 0)
+            break;
+        Interval &left = intervals[worst], &right = intervals[size++];
+        double middle = 0.5 * (left.a + left.b);
+        right = {middle, left.b, 0.0, 0.0, ++left.depth};
+        left.b = middle;
+        left.value = gaussKronrodRule(fun, left.a, middle, left.error);
+        right.value = gaussKronrodRule(fun, middle, right.b, right.error);
+        value = error = 0.0;
+        for (int i = 0; i != size; ++i) {
+            value += intervals[i].value;
+            error += intervals[i].error;
+        }
+    }
+    return value;
+}
+
+/**
+ * @fn evaluateIntegrand
+ * @param fun integrand f(x) or f(x, xc)
+ * @param x
+ * @param xc complement of x: a - x near lower boundary a, b - x near upper boundary b
+ * (infinite, if both boundaries are infinite), as in tanh_sinh of Boost.
+ * Unlike x, it doesn't lose accuracy near the boundaries
+ * @return f(x) or f(x, xc), whichever is defined
+ */
+template <class Function>
+double evaluateIntegrand(const Function &fun, double x, double xc)
+{
+    if constexpr (std::is_invocable_r_v<double, const Function &, double, double>)
+        return fun(x, xc);
+    else
+        return fun(x);
+}
+
+/**
+ * @fn doubleExponentialIntegral
+ * Double exponential quadrature: substitution x = x(t), after which integrand decays
+ * double exponentially, and trapezoidal rule with step 2^-k for k = 0, ..., maxLevel.
+ * Finite interval is mapped by tanh-sinh substitution, half-infinite by exp-sinh
+ * and infinite one by sinh-sinh. Hence the rule handles integrable singularities
+ * at finite boundaries and slow decay at infinite ones.
+ * Nodes, which are closer to a non-zero boundary than half of its ulp, round onto it.
+ * Integrand f(x, xc) gets their exact distance to the boundary and keeps them,
+ * while for f(x) they are dropped and the bound of their mass is added to the error
+ * @param fun integrand f(x) or f(x, xc), see evaluateIntegrand
+ * @param a lower boundary, can be -∞
+ * @param b upper boundary, can be ∞
+ * @param error estimate of absolute error in output: difference of the last two steps
+ * and the bound of the mass of dropped nodes
+ * @param epsilon absolute tolerance
+ * @param maxLevel the smallest step is 2^-maxLevel
+ * @return
+ */
+template <class Function>
+double doubleExponentialIntegral(const Function &fun, double a, double b, double &error,
+                                 double epsilon = 1e-11, int maxLevel = 8)
+{
+    error = 0.0;
+    if (a > b)
+        return -doubleExponentialIntegral(fun, b, a, error, epsilon, maxLevel);
+    if (a == b)
+        return 0.0;
+    static constexpr double EPS = std::numeric_limits<double>::epsilon();
+    /// beyond this point weights or abscissas are out of range of double
+    static constexpr int T_MAX = 6;
+    static constexpr bool HAS_COMPLEMENT = std::is_invocable_r_v<double, const Function &, double, double>;
+    const bool isLeftFinite = std::isfinite(a), isRightFinite = std::isfinite(b);
+    const double length = b - a;
+    /// the farthest node, which is kept on each side of t = 0, and whether any node beyond it is dropped
+    struct Tail
+    {
+        double t, term;
+        bool isDropped;
+    };
+    Tail tails[2] = {{0.0, 0.0, false}, {0.0, 0.0, false}};
+    /// integrand after substitution: f(x(t)) x'(t), zero where x(t) reaches the boundary
+    auto integrand = [&fun, &tails, a, b, isLeftFinite, isRightFinite, length] (double t) -> double
+    {
+        double expT = std::exp(t);
+        double coshT = 0.5 * (expT + 1.0 / expT);
+        double s = 0.25 * M_PI * (expT - 1.0 / expT);
+        double x = 0.0, xc = INFINITY, weight = 0.0;
+        bool isOnBoundary = false;
+        if (isLeftFinite && isRightFinite) {
+            /// distance to the closest boundary is calculated without cancellation
+            double e = std::exp(-2 * std::fabs(s));
+            double distance = length * e / (1.0 + e);
+            if (distance == 0.0)
+                return 0.0;
+            x = (t < 0) ? a + distance : b - distance;
+            xc = (t < 0) ? -distance : distance;
+            isOnBoundary = (x <= a || x >= b);
+            weight = M_PI * length * coshT * e / ((1.0 + e) * (1.0 + e));
+        }
+        else if (isLeftFinite || isRightFinite) {
+            double expS = std::exp(s);
+            if (expS == 0.0)
+                return 0.0;
+            x = isLeftFinite ? a + expS : b - expS;
+            if (!std::isfinite(x))
+                return 0.0;
+            xc = isLeftFinite ? -expS : expS;
+            isOnBoundary = (x == a || x == b);
+            weight = M_PI_2 * coshT * expS;
+        }
+        else {
+            x = std::sinh(s);
+            if (!std::isfinite(x))
+                return 0.0;
+            weight = M_PI_2 * coshT * std::cosh(s);
+        }
+        if (weight == 0.0)
+            return 0.0;
+        Tail &tail = tails[t > 0];
+        if (!HAS_COMPLEMENT && isOnBoundary) {
+            tail.isDropped = true;
+            return 0.0;
+        }
+        double term = evaluateIntegrand(fun, x, xc) * weight;
+        if (std::fabs(t) > std::fabs(tail.t)) {
+            tail.t = t;
+            tail.term = std::fabs(term);
+        }
+        return term;
+    };
+
+    /// step 1: terms are calculated up to T_MAX, and those below the rounding error are dropped at the next steps
+    double terms[2 * T_MAX + 1];
+    double sum = 0.0, sumAbs = 0.0;
+    for (int j = -T_MAX; j <= T_MAX; ++j) {
+        terms[j + T_MAX] = integrand(j);
+        sum += terms[j + T_MAX];
+        sumAbs += std::fabs(terms[j + T_MAX]);
+    }
+    int tLeft = -T_MAX, tRight = T_MAX;
+    while (tLeft < 0 && std::fabs(terms[tLeft + T_MAX]) <= EPS * sumAbs)
+        ++tLeft;
+    while (tRight > 0 && std::fabs(terms[tRight + T_MAX]) <= EPS * sumAbs)
+        --tRight;
+    /// keep one more step of margin
+    double tMin = std::max(tLeft - 1, -T_MAX), tMax = std::min(tRight + 1, T_MAX);
+
+    double value = sum;
+    double h = 1.0;
+    for (int level = 1; level <= maxLevel; ++level) {
+        h *= 0.5;
+        /// new nodes are the middle points of the previous ones
+        for (double t = tMin + h; t < tMax; t += 2 * h)
+            sum += integrand(t);
+        double newValue = h * sum;
+        error = std::fabs(newValue - value);
+        value = newValue;
+        if (level >= 2 && error <= std::max(epsilon, 50 * EPS * std::fabs(value)))
+            break;
+    }
+    /// integrand doesn't grow towards an integrable singularity after substitution,
+    /// hence the farthest kept term bounds the dropped ones up to the end of the range
+    for (const Tail &tail : tails) {
+        if (tail.isDropped)
+            error += tail.term * std::max(T_MAX - std::fabs(tail.t), 0.0);
+    }
+    return value;
+}
+
 /**
  * @fn integral
- * @param funPtr integrand
+ * Adaptive Gauss-Kronrod quadrature. Infinite intervals are mapped on (0, 1]
+ * by substitution x = a + (1 - t) / t, as in QUADPACK. If the tolerance is not reached,
+ * for instance because of singularities at the boundaries, double exponential quadrature
+ * is tried and the result with smaller error is chosen. It is tried as well if the result
+ * is below the absolute tolerance, as Gauss-Kronrod nodes can miss the mass near a boundary
+ * @param fun integrand f(x) or f(x, xc), see evaluateIntegrand
  * @param a lower boundary
  * @param b upper boundary
+ * @param error estimate of absolute error of the chosen result in output
  * @param epsilon tolerance
- * @param maxRecursionDepth how deep should the algorithm go
+ * @param maxRecursionDepth how many times an interval can be bisected
+ * @return
+ */
+template <class Function>
+double integral(const Function &fun, double a, double b, double &error, double epsilon = 1e-11, int maxRecursionDepth = 11)
+{
+    error = 0.0;
+    if (a > b)
+        return -integral(fun, b, a, error, epsilon, maxRecursionDepth);
+    if (a == b)
+        return 0.0;
+    double value = 0.0;
+    bool isLeftFinite = std::isfinite(a), isRightFinite = std::isfinite(b);
+    if (isLeftFinite && isRightFinite) {
+        double center = 0.5 * (a + b);
+        value = gaussKronrodIntegral([&fun, a, b, center] (double x)
+        {
+            return evaluateIntegrand(fun, x, (x < center) ? a - x : b - x);
+        },
+        a, b, error, epsilon, maxRecursionDepth);
+    }
+    else {
+        value = gaussKronrodIntegral([&fun, a, b, isLeftFinite, isRightFinite] (double t)
+        {
+            double x = (1.0 - t) / t;
+            double y = 0.0;
+            if (isLeftFinite)
+                y = evaluateIntegrand(fun, a + x, -x);
+            else if (isRightFinite)
+                y = evaluateIntegrand(fun, b - x, x);
+            else
+                y = evaluateIntegrand(fun, x, INFINITY) + evaluateIntegrand(fun, -x, INFINITY);
+            return y / (t * t);
+        },
+        0.0, 1.0, error, epsilon, maxRecursionDepth);
+    }
+    double tolerance = std::max(epsilon, 50 * std::numeric_limits<double>::epsilon() * std::fabs(value));
+    bool isNearZero = std::fabs(value) <= epsilon;
+    if (error <= tolerance && !isNearZero)
+        return value;
+    double errorDE = 0.0;
+    double valueDE = doubleExponentialIntegral(fun, a, b, errorDE, epsilon);
+    if ((isNearZero && errorDE <= std::max(epsilon, 50 * std::numeric_limits<double>::epsilon() * std::fabs(valueDE)))
+            || errorDE < error) {
+        error = errorDE;
+        return valueDE;
+    }
+    return value;
+}
+
+/**
+ * @fn integral
+ * the same with default tolerance, when the error estimate is not needed
+ * @param fun integrand f(x) or f(x, xc), see evaluateIntegrand
+ * @param a lower boundary
+ * @param b upper boundary
  * @return
  */
-double integral(const std::function<double (double)> &funPtr, double a, double b,
-                            double epsilon = 1e-11, int maxRecursionDepth = 11);
+template <class Function>
+double integral(const Function &fun, double a, double b)
+{
+    double error = 0.0;
+    return integral(fun, a, b, error);
+}
 
 /**
  * @fn findRootNewtonSecondOrder
@@ -30,8 +354,8 @@ double integral(const std::function<double (double)> &funPtr, double a, double b
  * @param stepTol step tolerance
  * @return true if success, false otherwise
  */
-template<typename RealType>
-bool findRootNewtonSecondOrder(const std::function<DoubleTriplet (RealType)> &funPtr, RealType & root,
+template<typename RealType, class Function>
+bool findRootNewtonSecondOrder(const Function &funPtr, RealType & root,
                                long double funTol = 1e-10, long double stepTol = 1e-6)
 {
     /// Sanity check
@@ -81,9 +405,9 @@ bool findRootNewtonSecondOrder(const std::function<DoubleTriplet (RealType)> &fu
  * @param stepTol step tolerance
  * @return true if success, false otherwise
  */
-template<typename RealType>
-bool findRootNewtonFirstOrder(const std::function<DoublePair (RealType)> &funPtr, RealType & root,
-                              long double funTol = 1e-10, long double stepTol = 1e-6)
+template<typename RealType, class Function>
+std::enable_if_t<std::is_invocable_r_v<DoublePair, const Function &, RealType>, bool>
+findRootNewtonFirstOrder(const Function &funPtr, RealType & root, long double funTol = 1e-10, long double stepTol = 1e-6)
 {
     /// Sanity check
     funTol = funTol > MIN_POSITIVE ? funTol : MIN_POSITIVE;
@@ -136,9 +460,67 @@ bool findRootNewtonFirstOrder(const std::function<DoublePair (RealType)> &funPtr
  * @param stepTol step tolerance
  * @return true if success, false otherwise
  */
-bool findRootNewtonFirstOrder2d(const std::function<DoublePair (DoublePair)> &funPtr,
-                                const std::function<std::tuple<DoublePair, DoublePair> (DoublePair)> &gradPtr,
-                                DoublePair & root, long double funTol = 1e-10, long double stepTol = 1e-6);
+template<class Function, class Gradient>
+bool findRootNewtonFirstOrder2d(const Function &funPtr, const Gradient &gradPtr,
+                                DoublePair & root, long double funTol = 1e-10, long double stepTol = 1e-6)
+{
+    /// Sanity check
+    funTol = funTol > MIN_POSITIVE ? funTol : MIN_POSITIVE;
+    stepTol = stepTol > MIN_POSITIVE ? stepTol : MIN_POSITIVE;
+    static constexpr int MAX_ITER = 1e5;
+    static constexpr double MAX_STEP = 10;
+    int iter = 0;
+    double step1 = stepTol + 1, step2 = step1;
+    DoublePair fun = funPtr(root);
+    double fun1 = fun.first;
+    double fun2 = fun.second;
+    double error = std::max(std::fabs(fun1), std::fabs(fun2));
+    if (error < MIN_POSITIVE)
+        return true;
+
+    auto [grad1, grad2] = gradPtr(root);
+    do {
+        double alpha = 1.0;
+        DoublePair oldRoot = root;
+        DoublePair oldFun = fun;
+        double oldError = error;
+        double det = grad1.first * grad2.second - grad1.second * grad2.first;
+        step1 = std::min(MAX_STEP, std::max(-MAX_STEP, (grad2.second * fun1 - grad1.second * fun2) / det));
+        step2 = std::min(MAX_STEP, std::max(-MAX_STEP, (-grad2.first * fun1 + grad1.first * fun2) / det));
+        do {
+            root.first = oldRoot.first - alpha * step1;
+            root.second = oldRoot.second - alpha * step2;
+            fun = funPtr(root);
+            fun1 = fun.first;
+            fun2 = fun.second;
+            error = std::max(std::fabs(fun1), std::fabs(fun2));
+            if (error < MIN_POSITIVE)
+                return true;
+            std::tie(grad1, grad2) = gradPtr(root);
+            det = grad1.first * grad2.second - grad1.second * grad2.first;
+            alpha *= 0.5;
+        } while ((std::fabs(det) <= MIN_POSITIVE || oldError < error) && alpha > 0);
+
+        /// Check convergence criteria
+        double diffX1 = std::fabs(root.first - oldRoot.first);
+        double diffX2 = std::fabs(root.second - oldRoot.second);
+        double diffX = std::max(diffX1, diffX2);
+        double relDiffX1 = std::fabs(diffX1 / oldRoot.first);
+        double relDiffX2 = std::fabs(diffX2 / oldRoot.second);
+        double relDiffX = std::max(relDiffX1, relDiffX2);
+        if (std::min(diffX, relDiffX) < stepTol)
+        {
+            double diffY1 = fun1- oldFun.first;
+            double diffY2 = fun2 - oldFun.second;
+            double relDiffY1 = std::fabs(diffY1 / oldFun.first);
+            double relDiffY2 = std::fabs(diffY2 / oldFun.second);
+            double relDiffY = std::max(relDiffY1, relDiffY2);
+            if (std::min(std::max(std::fabs(fun1), std::fabs(fun2)), relDiffY) < funTol)
+                return true;
+        }
+    } while (++iter < MAX_ITER);
+    return false;
+}
 
 /**
  * @fn findRoot
@@ -150,8 +532,9 @@ bool findRootNewtonFirstOrder2d(const std::function<DoublePair (DoublePair)> &fu
  * @param epsilon tolerance
  * @return true if success, false otherwise
  */
-template<typename RealType>
-bool findRootNewtonFirstOrder(const std::function<double (RealType)> &funPtr, RealType a, RealType b, RealType & root, long double epsilon = 1e-8)
+template<typename RealType, class Function>
+std::enable_if_t<std::is_invocable_r_v<double, const Function &, RealType>, bool>
+findRootNewtonFirstOrder(const Function &funPtr, RealType a, RealType b, RealType & root, long double epsilon = 1e-8)
 {
     /// Sanity check
     epsilon = epsilon > MIN_POSITIVE ? epsilon : MIN_POSITIVE;
@@ -264,8 +647,8 @@ double parabolicMinimum(RealType a, RealType b, RealType c, double fa, double fb
  * @param epsilon tolerance
  * @return true if success
  */
-template<typename RealType>
-bool findMin(const std::function<double (RealType)> &funPtr, const Triplet<RealType> & abc, double &fx, RealType &root, double epsilon)
+template<typename RealType, class Function>
+bool findMin(const Function &funPtr, const Triplet<RealType> & abc, double &fx, RealType &root, double epsilon)
 {
     static constexpr double K = 0.5 * (3 - M_SQRT5);
     auto [a, x, c] = abc;
@@ -354,8 +737,8 @@ bool findMin(const std::function<double (RealType)> &funPtr, const Triplet<RealT
  * @param epsilon tolerance
  * @return true if success
  */
-template<typename RealType>
-bool findMin(const std::function<double (RealType)> &funPtr, RealType closePoint, RealType &root, long double epsilon = 1e-8)
+template<typename RealType, class Function>
+bool findMin(const Function &funPtr, RealType closePoint, RealType &root, long double epsilon = 1e-8)
 {
     Triplet<RealType> abc;
     static constexpr double K = 0.5 * (M_SQRT5 + 1);
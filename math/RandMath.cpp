@@ -1,5 +1,6 @@
 ﻿#include "RandMath.h"
 #include "NumericMath.h"
+#include "VectorMath.h"
 #include <functional>
 
 namespace RandMath
@@ -47,6 +48,57 @@ double log2mexp(double x)
     return std::log1pl(-std::expm1l(x));
 }
 
+/// Chebyshev coefficients of inverse erf: ERFINV_MU for |1 - p| < 5e-16,
+/// ERFINV_DELTA for 5e-16 < |1 - p| < 0.0025, ERFINV_LAMBDA for 0.8 < p < 0.9975
+/// and ERFINV_XI for 0 < p < 0.8. Tails are expanded in beta = sqrt(-log(1 - p^2))
+constexpr int ERFINV_MU_SIZE = 26;
+constexpr long double ERFINV_MU[ERFINV_MU_SIZE] = {
+    .9885750640661893136460358l, .0108577051845994776160281l, -.0017511651027627952594825l, .0000211969932065633437984l,
+    .0000156648714042435087911l, -.05190416869103124261e-5l, -.00371357897426717780e-5l, .00012174308662357429e-5l,
+    -.00001768115526613442e-5l, -.119372182556161e-10l, .003802505358299e-10l, -.000660188322362e-10l, -.000087917055170e-10l,
+    -.3506869329e-15l, -.0697221497e-15l, -.0109567941e-15l, -.0011536390e-15l, -.0000263938e-15l, .05341e-20l, -.22610e-20l,
+    .09552e-20l, -.05250e-20l, .02487e-20l, -.01134e-20l, .00420e-20l
+};
+
+constexpr int ERFINV_DELTA_SIZE = 38;
+constexpr long double ERFINV_DELTA[ERFINV_DELTA_SIZE] = {
+    .9566797090204925274526373l, -.0231070043090649036999908l, -.0043742360975084077333218l, -.0005765034226511854809364l,
+    -.0000109610223070923931242l, .0000251085470246442787982l, .0000105623360679477511955l, .27544123300306391503e-5l,
+    .04324844983283380689e-5l, -.00205303366552086916e-5l, -.00438915366654316784e-5l, -.00176840095080881795e-5l,
+    -.00039912890280463420e-5l, -.00001869324124559212e-5l, .00002729227396746077e-5l, .00001328172131565497e-5l,
+    .318342484482286e-10l, .016700607751926e-10l, -.020364649611537e-10l, -.009648468127965e-10l, -.002195672778128e-10l,
+    -.000095689813014e-10l, .000137032572230e-10l, .000062538505417e-10l, .000014584615266e-10l, .1078123993e-15l,
+    -.0709229988e-15l, -.0391411775e-15l, -.0111659209e-15l, -.0015770366e-15l, .0002853149e-15l, .0002716662e-15l,
+    .0000176835e-15l, .09828e-20l, .20464e-20l, .08020e-20l, .01650e-20l
+};
+
+constexpr int ERFINV_LAMBDA_SIZE = 27;
+constexpr long double ERFINV_LAMBDA[ERFINV_LAMBDA_SIZE] = {
+    .9121588034175537733059200l, -.0162662818676636958546661l, .0004335564729494453650589l, .0002144385700744592065205l,
+    .26257510757648130176e-5l, -.30210910501037969912e-5l, -.00124060618367572157e-5l, .00624066092999917380e-5l,
+    -.00005401247900957858e-5l, -.00014232078975315910e-5l, .343840281955305e-10l, .335848703900138e-10l, -.014584288516512e-10l,
+    -.008102174258833e-10l, .000525324085874e-10l, .000197115408612e-10l, -.000017494333828e-10l, -.4800596619e-15l, .0557302987e-15l,
+    .0116326054e-15l, -.0017262489e-15l, -.0002784973e-15l, .0000524481e-15l, .65270e-20l, -.15707e-20l, -.01475e-20l, .00450e-20l
+};
+
+constexpr int ERFINV_XI_SIZE = 39;
+constexpr long double ERFINV_XI[ERFINV_XI_SIZE] = {
+    .9928853766189408231495800l, .1204675161431044864647846l, .0160781993420999447267039l, .0026867044371623158279591l,
+    .0004996347302357262947170l, .0000988982185991204409911l, .0000203918127639944337340l, .43272716177354218758e-5l,
+    .09380814128593406758e-5l, .02067347208683427411e-5l, .00461596991054300078e-5l, .00104166797027146217e-5l,
+    .00023715009995921222e-5l, .00005439284068471390e-5l, .00001255489864097987e-5l, .291381803663201e-10l,
+    .067949421808797e-10l, .015912343331569e-10l, .003740250585245e-10l, .000882087762421e-10l, .000208650897725e-10l,
+    .000049488041039e-10l, .000011766394740e-10l, .2803855725e-15l, .0669506638e-15l, .0160165495e-15l, .0038382583e-15l,
+    .0009212851e-15l, .0002214615e-15l, .0000533091e-15l, .0000128488e-15l, .31006e-20l, .07491e-20l, .01812e-20l,
+    .00439e-20l, .00106e-20l, .00026e-20l, .00006e-20l, .00002e-20l
+};
+
+/// Chebyshev argument t is D5 / sqrt(beta) + D6 for ERFINV_MU,
+/// D3 * beta + D4 for ERFINV_DELTA and D1 * beta + D2 for ERFINV_LAMBDA
+constexpr long double ERFINV_D1 = -1.548813042373261659512742l, ERFINV_D2 = 2.565490123147816151928163l;
+constexpr long double ERFINV_D3 = -0.5594576313298323225436913l, ERFINV_D4 = 2.287915716263357638965891l;
+constexpr long double ERFINV_D5 = -9.199992358830151031278420l, ERFINV_D6 = 2.794990820124599493768426l;
+
 double erfinvChebyshevSeries(double x, long double t, const long double *array, int size)
 {
     /// We approximate inverse erf via Chebyshev polynomials
@@ -65,58 +117,25 @@ double erfinvChebyshevSeries(double x, long double t, const long double *array,
 double erfinvAux1(double beta)
 {
     /// |1 - p| < 5e-16
-    static constexpr long double D5 = -9.199992358830151031278420l, D6 = 2.794990820124599493768426l;
-    static constexpr int muSize = 26;
-    static constexpr long double mu[muSize] = {.9885750640661893136460358l, .0108577051845994776160281l, -.0017511651027627952594825l, .0000211969932065633437984l,
-                                               .0000156648714042435087911l, -.05190416869103124261e-5l, -.00371357897426717780e-5l, .00012174308662357429e-5l,
-                                              -.00001768115526613442e-5l, -.119372182556161e-10l, .003802505358299e-10l, -.000660188322362e-10l, -.000087917055170e-10l,
-                                              -.3506869329e-15l, -.0697221497e-15l, -.0109567941e-15l, -.0011536390e-15l, -.0000263938e-15l, .05341e-20l, -.22610e-20l,
-                                               .09552e-20l, -.05250e-20l, .02487e-20l, -.01134e-20l, .00420e-20l};
-    return erfinvChebyshevSeries(beta, D5 / std::sqrt(beta) + D6, mu, muSize);
+    return erfinvChebyshevSeries(beta, ERFINV_D5 / std::sqrt(beta) + ERFINV_D6, ERFINV_MU, ERFINV_MU_SIZE);
 }
 
 double erfinvAux2(double beta)
 {
-    /// 5e-16 < |1 - p| < 0.025
-    static constexpr long double D3 = -0.5594576313298323225436913l, D4 = 2.287915716263357638965891l;
-    static constexpr int deltaSize = 38;
-    static constexpr long double delta[deltaSize] = {.9566797090204925274526373l, -.0231070043090649036999908l, -.0043742360975084077333218l, -.0005765034226511854809364l,
-                                                    -.0000109610223070923931242l, .0000251085470246442787982l, .0000105623360679477511955l, .27544123300306391503e-5l,
-                                                     .04324844983283380689e-5l, -.00205303366552086916e-5l, -.00438915366654316784e-5l, -.00176840095080881795e-5l,
-                                                    -.00039912890280463420e-5l, -.00001869324124559212e-5l, .00002729227396746077e-5l, .00001328172131565497e-5l,
-                                                     .318342484482286e-10l, .016700607751926e-10l, -.020364649611537e-10l, -.009648468127965e-10l, -.002195672778128e-10l,
-                                                    -.000095689813014e-10l, .000137032572230e-10l, .000062538505417e-10l, .000014584615266e-10l, .1078123993e-15l,
-                                                    -.0709229988e-15l, -.0391411775e-15l, -.0111659209e-15l, -.0015770366e-15l, .0002853149e-15l, .0002716662e-15l,
-                                                     .0000176835e-15l, .09828e-20l, .20464e-20l, .08020e-20l, .01650e-20l};
-    return erfinvChebyshevSeries(beta, D3 * beta + D4, delta, deltaSize);
+    /// 5e-16 < |1 - p| < 0.0025
+    return erfinvChebyshevSeries(beta, ERFINV_D3 * beta + ERFINV_D4, ERFINV_DELTA, ERFINV_DELTA_SIZE);
 }
 
 double erfinvAux3(double beta)
 {
-    /// 0.8 < p < 0.975
-    static constexpr long double D1 = -1.548813042373261659512742l, D2 = 2.565490123147816151928163l;
-    static constexpr int lambdaSize = 27;
-    static constexpr long double lambda[lambdaSize] = {.9121588034175537733059200l, -.0162662818676636958546661l, .0004335564729494453650589l, .0002144385700744592065205l,
-                                                       .26257510757648130176e-5l, -.30210910501037969912e-5l, -.00124060618367572157e-5l, .00624066092999917380e-5l,
-                                                      -.00005401247900957858e-5l, -.00014232078975315910e-5l, .343840281955305e-10l, .335848703900138e-10l, -.014584288516512e-10l,
-                                                      -.008102174258833e-10l, .000525324085874e-10l, .000197115408612e-10l, -.000017494333828e-10l, -.4800596619e-15l, .0557302987e-15l,
-                                                       .0116326054e-15l, -.0017262489e-15l, -.0002784973e-15l, .0000524481e-15l, .65270e-20l, -.15707e-20l, -.01475e-20l, .00450e-20l};
-    return erfinvChebyshevSeries(beta, D1 * beta + D2, lambda, lambdaSize);
+    /// 0.8 < p < 0.9975
+    return erfinvChebyshevSeries(beta, ERFINV_D1 * beta + ERFINV_D2, ERFINV_LAMBDA, ERFINV_LAMBDA_SIZE);
 }
 
 double erfinvAux4(double p)
 {
     /// 0 < p < 0.8
-    static constexpr int xiSize = 39;
-    static constexpr long double xi[xiSize] = {.9928853766189408231495800l, .1204675161431044864647846l, .0160781993420999447267039l, .0026867044371623158279591l,
-                                               .0004996347302357262947170l, .0000988982185991204409911l, .0000203918127639944337340l, .43272716177354218758e-5l,
-                                               .09380814128593406758e-5l, .02067347208683427411e-5l, .00461596991054300078e-5l, .00104166797027146217e-5l,
-                                               .00023715009995921222e-5l, .00005439284068471390e-5l, .00001255489864097987e-5l, .291381803663201e-10l,
-                                               .067949421808797e-10l, .015912343331569e-10l, .003740250585245e-10l, .000882087762421e-10l, .000208650897725e-10l,
-                                               .000049488041039e-10l, .000011766394740e-10l, .2803855725e-15l, .0669506638e-15l, .0160165495e-15l, .0038382583e-15l,
-                                               .0009212851e-15l, .0002214615e-15l, .0000533091e-15l, .0000128488e-15l, .31006e-20l, .07491e-20l, .01812e-20l,
-                                               .00439e-20l, .00106e-20l, .00026e-20l, .00006e-20l, .00002e-20l};
-    return erfinvChebyshevSeries(p, p * p / 0.32 - 1.0, xi, xiSize);
+    return erfinvChebyshevSeries(p, p * p / 0.32 - 1.0, ERFINV_XI, ERFINV_XI_SIZE);
 }
 
 double erfinv(double p)
@@ -139,6 +158,116 @@ double erfinv(double p)
     return (1.0 - p < 5e-16) ? erfinvAux1(beta) : erfinvAux2(beta);
 }
 
+/**
+ * @fn erfinvChebyshevBlocks
+ * erfinvChebyshevSeries in blocks
+ * @param x
+ * @param t
+ * @param array
+ * @param size
+ * @param y
+ * @param n multiple of VECTOR_MATH_BLOCK_SIZE
+ */
+void erfinvChebyshevBlocks(const double *x, const double *t, const long double *array, int size, double *y, size_t n)
+{
+    constexpr size_t BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    double Tn[BLOCK], Tnm1[BLOCK], sum[BLOCK];
+    for (size_t start = 0; start != n; start += BLOCK) {
+        for (size_t j = 0; j != BLOCK; ++j) {
+            Tn[j] = t[start + j];
+            Tnm1[j] = 1.0;
+            sum[j] = 0.0;
+        }
+        for (int i = 1; i != size; ++i) {
+            double coef = array[i];
+            for (size_t j = 0; j != BLOCK; ++j) {
+                sum[j] += coef * Tn[j];
+                double temp = Tn[j];
+                Tn[j] = 2 * t[start + j] * Tn[j] - Tnm1[j];
+                Tnm1[j] = temp;
+            }
+        }
+        double coef0 = array[0];
+        for (size_t j = 0; j != BLOCK; ++j)
+            y[start + j] = x[start + j] * (coef0 + sum[j]);
+    }
+}
+
+void erfinv(const double *p, double *y, size_t n)
+{
+    /// groups of |p|: 0 < |p| < 0.8, 0.8 <= |p| < 0.9975 and 0.9975 <= |p| <= 1 - 5e-16,
+    /// the rest goes to the scalar function
+    enum { XI, LAMBDA, DELTA, SCALAR };
+    constexpr size_t SIZE = VECTOR_MATH_BUFFER_SIZE, BLOCK = VECTOR_MATH_BLOCK_SIZE;
+    int group[SIZE];
+    size_t order[SIZE];
+    /// arguments of one group, padded to whole blocks
+    double ps[SIZE + BLOCK], betas[SIZE + BLOCK], ts[SIZE + BLOCK], ys[SIZE + BLOCK];
+    for (size_t start = 0; start < n; start += SIZE) {
+        size_t size = std::min(SIZE, n - start);
+        const double *pc = p + start;
+        double *yc = y + start;
+        size_t groupStart[SCALAR + 2] = {};
+        for (size_t i = 0; i != size; ++i) {
+            double absP = std::fabs(pc[i]);
+            if (absP > 0.0 && absP < 0.8)
+                group[i] = XI;
+            else if (absP >= 0.8 && absP < 0.9975)
+                group[i] = LAMBDA;
+            else if (absP >= 0.9975 && 1.0 - absP >= 5e-16)
+                group[i] = DELTA;
+            else
+                group[i] = SCALAR;
+            ++groupStart[group[i] + 1];
+        }
+        for (int g = 0; g <= SCALAR; ++g)
+            groupStart[g + 1] += groupStart[g];
+        size_t groupEnd[SCALAR + 1];
+        std::copy(groupStart, groupStart + SCALAR + 1, groupEnd);
+        for (size_t i = 0; i != size; ++i)
+            order[groupEnd[group[i]]++] = i;
+
+        for (int g = XI; g != SCALAR; ++g) {
+            size_t begin = groupStart[g], m = groupStart[g + 1] - begin;
+            if (m == 0)
+                continue;
+            size_t padded = (m + BLOCK - 1) / BLOCK * BLOCK;
+            for (size_t k = 0; k != m; ++k)
+                ps[k] = std::fabs(pc[order[begin + k]]);
+            std::fill(ps + m, ps + padded, ps[0]);
+            if (g == XI) {
+                for (size_t k = 0; k != padded; ++k)
+                    ts[k] = ps[k] * ps[k] / 0.32 - 1.0;
+                erfinvChebyshevBlocks(ps, ts, ERFINV_XI, ERFINV_XI_SIZE, ys, padded);
+            }
+            else {
+                /// beta = sqrt(-log(1 - p^2))
+                for (size_t k = 0; k != padded; ++k)
+                    betas[k] = -ps[k] * ps[k];
+                vlog1p(betas, betas, padded);
+                for (size_t k = 0; k != padded; ++k)
+                    betas[k] = std::sqrt(-betas[k]);
+                double slope = (g == LAMBDA) ? ERFINV_D1 : ERFINV_D3;
+                double intercept = (g == LAMBDA) ? ERFINV_D2 : ERFINV_D4;
+                for (size_t k = 0; k != padded; ++k)
+                    ts[k] = slope * betas[k] + intercept;
+                if (g == LAMBDA)
+                    erfinvChebyshevBlocks(betas, ts, ERFINV_LAMBDA, ERFINV_LAMBDA_SIZE, ys, padded);
+                else
+                    erfinvChebyshevBlocks(betas, ts, ERFINV_DELTA, ERFINV_DELTA_SIZE, ys, padded);
+            }
+            for (size_t k = 0; k != m; ++k) {
+                size_t i = order[begin + k];
+                yc[i] = (pc[i] < 0.0) ? -ys[k] : ys[k];
+            }
+        }
+        for (size_t k = groupStart[SCALAR]; k != size; ++k) {
+            size_t i = order[k];
+            yc[i] = erfinv(pc[i]);
+        }
+    }
+}
+
 double erfcinv(double p)
 {
     /// Consider special cases
@@ -177,7 +306,81 @@ double xexpxsqerfc(double x)
     return (1.0 + sum) / M_SQRTPI;
 }
 
-double harmonicNumber(double exponent, int number)
+namespace
+{
+
+/// number of terms, which are summed directly, before Euler-Maclaurin formula is applied
+constexpr int HARMONIC_DIRECT_TERMS = 16;
+
+/// B_{2j} / (2j)! for j = 1, ..., 8, where B stands for Bernoulli numbers
+constexpr double BERNOULLI_BY_FACTORIAL[8] = {
+    1.0 / 12.0, -1.0 / 720.0, 1.0 / 30240.0, -1.0 / 1209600.0, 1.0 / 47900160.0,
+    -691.0 / 1307674368000.0, 1.0 / 74724249600.0, -3617.0 / 10670622842880000.0
+};
+
+/**
+ * @fn eulerMaclaurinCorrection
+ * @param exponent
+ * @param x
+ * @return f(x) / 2 + sum_{j=1}^{8} B_{2j} / (2j)! f^{(2j-1)}(x) for f(x) = x^{-exponent}
+ */
+double eulerMaclaurinCorrection(double exponent, double x)
+{
+    double f = std::exp(-exponent * std::log(x));
+    double invXSq = 1.0 / (x * x);
+    double derivative = -exponent * f / x;
+    double sum = 0.5 * f;
+    for (int j = 0; j != 8; ++j) {
+        sum += BERNOULLI_BY_FACTORIAL[j] * derivative;
+        double m = 2 * j + 1;
+        derivative *= (exponent + m) * (exponent + m + 1) * invXSq;
+    }
+    return sum;
+}
+
+/**
+ * @fn powerIntegral
+ * @param exponent
+ * @param a
+ * @param b
+ * @return ∫_a^b x^{-exponent} dx, stable for exponent close to 1
+ */
+double powerIntegral(double exponent, double a, double b)
+{
+    double logRatio = std::log(b / a);
+    double y = (1.0 - exponent) * logRatio;
+    double expm1DivY = (std::fabs(y) > 1e-8) ? std::expm1(y) / y : 1.0 + 0.5 * y * (1.0 + y / 3.0);
+    return std::exp((1.0 - exponent) * std::log(a)) * logRatio * expm1DivY;
+}
+
+/**
+ * @fn harmonicNumberHead
+ * @param exponent
+ * @return sum_{i=1}^{N} i^{-exponent} - correction at N, which doesn't depend on number,
+ * for N = HARMONIC_DIRECT_TERMS. For exponent > 1 it's equal to ζ(exponent)
+ */
+double harmonicNumberHead(double exponent)
+{
+    double sum = 0.0;
+    for (int i = HARMONIC_DIRECT_TERMS; i > 0; --i)
+        sum += std::pow(i, -exponent);
+    return sum - eulerMaclaurinCorrection(exponent, HARMONIC_DIRECT_TERMS);
+}
+
+/**
+ * @fn harmonicNumberTail
+ * @param exponent
+ * @param number
+ * @return part of Euler-Maclaurin formula, which depends on number
+ */
+double harmonicNumberTail(double exponent, double number)
+{
+    return powerIntegral(exponent, HARMONIC_DIRECT_TERMS, number) + eulerMaclaurinCorrection(exponent, number);
+}
+
+}
+
+double harmonicNumber(double exponent, long long int number)
 {
     if (number < 1)
         return 0;
@@ -185,10 +388,33 @@ double harmonicNumber(double exponent, int number)
         return M_EULER + digamma(number + 1);
     if (exponent == 2)
         return M_PI_SQ / 6.0 - trigamma(number + 1);
-    double res = 1.0;
-    for (int i = 2; i <= number; ++i)
-        res += std::pow(i, -exponent);
-    return res;
+    if (number <= HARMONIC_DIRECT_TERMS) {
+        double res = 1.0;
+        for (int i = 2; i <= number; ++i)
+            res += std::pow(i, -exponent);
+        return res;
+    }
+    /// Euler-Maclaurin formula: remainder after 8 terms is bounded by
+    /// |B_18 / 18! f^{(17)}(N)|, which is negligible for N = 16 and reasonable exponents
+    return harmonicNumberHead(exponent) + harmonicNumberTail(exponent, number);
+}
+
+void harmonicNumber(double exponent, const std::vector<long long int> &numbers, std::vector<double> &output)
+{
+    /// direct partial sums and the constant part of Euler-Maclaurin formula are shared
+    double partialSums[HARMONIC_DIRECT_TERMS + 1];
+    partialSums[0] = 0.0;
+    for (int i = 1; i <= HARMONIC_DIRECT_TERMS; ++i)
+        partialSums[i] = partialSums[i - 1] + std::pow(i, -exponent);
+    double head = partialSums[HARMONIC_DIRECT_TERMS] - eulerMaclaurinCorrection(exponent, HARMONIC_DIRECT_TERMS);
+    output.resize(numbers.size());
+    for (size_t i = 0; i != numbers.size(); ++i) {
+        long long int number = numbers[i];
+        if (number <= HARMONIC_DIRECT_TERMS)
+            output[i] = (number < 1) ? 0.0 : partialSums[number];
+        else
+            output[i] = head + harmonicNumberTail(exponent, number);
+    }
 }
 
 long double logBesselI(double nu, double x)
@@ -487,8 +713,11 @@ double MarcumQIntergralRepresentation(double mu, double x, double y, double sqrt
     double yPrime = y / mu;
     double s0 = 0.5 * (1.0 + sqrt1pXiSq) / yPrime;
     double phi = x / s0 + y * s0 - std::log(s0) * mu;
-    std::function<double (double)> integrandPtr = std::bind(&MarcumQIntegrand, std::placeholders::_1, xi, sqrt1pXiSq, mu, yPrime);
-    double integral = RandMath::integral(integrandPtr, -M_PI, M_PI);
+    double integral = RandMath::integral([xi, sqrt1pXiSq, mu, yPrime] (double theta)
+    {
+        return MarcumQIntegrand(theta, xi, sqrt1pXiSq, mu, yPrime);
+    },
+    -M_PI, M_PI);
     return 0.5 * std::exp(-x - y + phi) / M_PI * integral;
 }
 
@@ -8,6 +8,7 @@
 #include <utility>
 #include <algorithm>
 #include <numeric>
+#include <array>
 
 #include "Constants.h"
 #include "GammaMath.h"
@@ -16,8 +17,57 @@
 namespace RandMath
 {
 
-template <int TABLE_SIZE>
-constexpr std::array<LongDoublePair, TABLE_SIZE> createZiggurat(const std::function<LongDoublePair (const LongDoublePair &)> &funPtr, LongDoublePair first, LongDoublePair second);
+/**
+ * @brief RANDLIB_ZIGGURAT_LAYERS
+ * default amount of layers in ziggurat samplers: 128, 256 or 1024
+ */
+#ifndef RANDLIB_ZIGGURAT_LAYERS
+#define RANDLIB_ZIGGURAT_LAYERS 256
+#endif
+
+/**
+ * @brief The ZigguratTable struct
+ * Layers of ziggurat for decreasing function f on [0, ∞), stored as plain arrays:
+ * x[i] - right edge of layer i (x[0] is the width of rectangle with the same area as the base layer,
+ * x[LAYERS] = 0), y[i] - upper edge of layer i, ratio[i] = x[i + 1] / x[i] - bound for fast acceptance
+ */
+template < typename T, size_t LAYERS >
+struct ZigguratTable
+{
+    std::array<T, LAYERS + 1> x{};
+    std::array<T, LAYERS> y{};
+    std::array<T, LAYERS> ratio{};
+};
+
+/**
+ * @fn createZiggurat
+ * @param r start of the tail
+ * @param v area of each layer
+ * @param f decreasing function
+ * @param fInv inverse of f
+ * @return ziggurat table
+ */
+template < typename T, size_t LAYERS, class Function, class InverseFunction >
+constexpr ZigguratTable<T, LAYERS> createZiggurat(long double r, long double v, Function f, InverseFunction fInv)
+{
+    std::array<long double, LAYERS + 1> x{};
+    std::array<long double, LAYERS> y{};
+    y[0] = f(r);
+    x[0] = v / y[0];
+    x[1] = r;
+    for (size_t i = 1; i != LAYERS; ++i) {
+        /// such y_i that f(x_{i+1}) = y_i
+        y[i] = y[i - 1] + v / x[i];
+        x[i + 1] = (i + 1 == LAYERS) ? 0.0l : fInv(y[i]);
+    }
+    ZigguratTable<T, LAYERS> table{};
+    for (size_t i = 0; i != LAYERS; ++i) {
+        table.x[i] = x[i];
+        table.y[i] = y[i];
+        table.ratio[i] = x[i + 1] / x[i];
+    }
+    return table;
+}
 
 /**
  * @fn areClose
@@ -85,6 +135,17 @@ double log2mexp(double x);
  */
 double erfinv(double p);
 
+/**
+ * @fn erfinv
+ * Inverse error function on array: arguments are grouped by the same ranges
+ * of Chebyshev expansions as in scalar function, and each group is evaluated
+ * in blocks of RandMath::VECTOR_MATH_BLOCK_SIZE
+ * @param p
+ * @param y y[i] = erfinv(p[i])
+ * @param n
+ */
+void erfinv(const double *p, double *y, size_t n);
+
 /**
  * @fn erfcinv
  * @param p
@@ -101,11 +162,22 @@ double xexpxsqerfc(double x);
 
 /**
  * @fn harmonicNumber
+ * Sums first 16 terms directly and the rest by Euler-Maclaurin formula,
+ * hence complexity doesn't depend on number
  * @param exponent
  * @param number
  * @return sum_{i=1}^{number} i^{-exponent}
  */
-double harmonicNumber(double exponent, int number);
+double harmonicNumber(double exponent, long long int number);
+
+/**
+ * @fn harmonicNumber
+ * Partial sums for many numbers with the same exponent
+ * @param exponent
+ * @param numbers
+ * @param output sum_{i=1}^{numbers[j]} i^{-exponent} for each j
+ */
+void harmonicNumber(double exponent, const std::vector<long long int> &numbers, std::vector<double> &output);
 
 /**
  * @fn logBesselI
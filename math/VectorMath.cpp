@@ -0,0 +1,691 @@
+#if defined(__GNUC__) && !defined(__clang__)
+/// GCC doesn't if-convert floating-point comparisons, which might raise exceptions.
+/// Kernels don't rely on floating-point exceptions, so selects can become blends.
+/// Contraction to FMA is disabled explicitly, so that results don't depend on instruction set
+#pragma GCC optimize("no-trapping-math", "fp-contract=off")
+#endif
+
+#include "VectorMath.h"
+#include "Constants.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RANDLIB_VECTORMATH_DISPATCH
+#endif
+
+/// Lanes are inlined into block loops even if they are large, otherwise loops are not vectorized,
+/// and block loops are inlined into kernels, which are compiled for each instruction set
+#ifdef __GNUC__
+#define RANDLIB_LANE_INLINE __attribute__((always_inline))
+#else
+#define RANDLIB_LANE_INLINE
+#endif
+
+namespace
+{
+
+inline unsigned long long toBits(double x)
+{
+    unsigned long long u;
+    std::memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+inline double fromBits(unsigned long long u)
+{
+    double x;
+    std::memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+inline unsigned int toBits(float x)
+{
+    unsigned int u;
+    std::memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+inline float fromBits(unsigned int u)
+{
+    float x;
+    std::memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+/// x + SHIFTER rounds x to integer, which is kept in the lowest bits of the sum
+constexpr double SHIFTER = 6755399441055744.0; ///< 1.5 * 2^52
+constexpr float SHIFTERF = 12582912.0f; ///< 1.5 * 2^23
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+constexpr float NaNF = std::numeric_limits<float>::quiet_NaN();
+
+/**
+ * @fn expm1Taylor
+ * @param r |r| <= 1/2
+ * @return r + r^2 (1/2! + r/3! + ... + r^13/15!), next term is below 2^-56 r
+ */
+RANDLIB_LANE_INLINE inline double expm1Taylor(double r)
+{
+    double y = 1.0 / 1307674368000;
+    y = y * r + 1.0 / 87178291200;
+    y = y * r + 1.0 / 6227020800;
+    y = y * r + 1.0 / 479001600;
+    y = y * r + 1.0 / 39916800;
+    y = y * r + 1.0 / 3628800;
+    y = y * r + 1.0 / 362880;
+    y = y * r + 1.0 / 40320;
+    y = y * r + 1.0 / 5040;
+    y = y * r + 1.0 / 720;
+    y = y * r + 1.0 / 120;
+    y = y * r + 1.0 / 24;
+    y = y * r + 1.0 / 6;
+    y = y * r + 1.0 / 2;
+    return r + r * (r * y);
+}
+
+/// Kernels return NaN for arguments out of their range,
+/// these elements are recomputed by the scalar function
+
+/**
+ * @brief The ExpLane struct
+ * exp(x) = 2^k exp(r), |r| <= log(2)/2, with Taylor polynomial of exp(r) - 1 for double
+ * and the polynomial of Cephes for float
+ */
+struct ExpLane
+{
+    RANDLIB_LANE_INLINE static double value(double x)
+    {
+        static constexpr double C1 = 6.93145751953125E-1, C2 = 1.42860682030941723212E-6;
+        double kd = x * M_LOG2E + SHIFTER;
+        unsigned long long k = toBits(kd);
+        kd -= SHIFTER;
+        double r = x - kd * C1;
+        r -= kd * C2;
+        double y = 1.0 + expm1Taylor(r);
+        y = fromBits(toBits(y) + (k << 52));
+        y = (std::fabs(x) < 708.0) ? y : NaN;
+        /// results, which are rounded to zero or overflow, are set here,
+        /// only subnormal and huge results near the limits need the scalar function
+        y = (x < -746.0) ? 0.0 : y;
+        return (x > 710.0) ? INFINITY : y;
+    }
+
+    RANDLIB_LANE_INLINE static float value(float x)
+    {
+        static constexpr float C1 = 0.693359375f, C2 = -2.12194440e-4f;
+        float kd = x * static_cast<float>(M_LOG2E) + SHIFTERF;
+        unsigned int k = toBits(kd);
+        kd -= SHIFTERF;
+        float r = x - kd * C1;
+        r -= kd * C2;
+        float rr = r * r;
+        float y = (((((1.9875691500E-4f * r + 1.3981999507E-3f) * r + 8.3334519073E-3f) * r
+                    + 4.1665795894E-2f) * r + 1.6666665459E-1f) * r + 5.0000001201E-1f) * rr + r + 1.0f;
+        y = fromBits(toBits(y) + (k << 23));
+        y = (std::fabs(x) < 87.0f) ? y : NaNF;
+        y = (x < -104.0f) ? 0.0f : y;
+        return (x > 89.0f) ? INFINITY : y;
+    }
+
+    template < typename T >
+    static T fallback(T x) { return std::exp(x); }
+};
+
+/**
+ * @brief The LogLane struct
+ * log(x) = k log(2) + log(m), sqrt(1/2) <= m < sqrt(2),
+ * with rational approximation of log(m) (Cephes)
+ */
+struct LogLane
+{
+    RANDLIB_LANE_INLINE static double value(double x)
+    {
+        unsigned long long u = toBits(x);
+        /// x = 2^e * m, 0.5 <= m < 1, e is obtained as a double without integer conversions
+        double m = fromBits((u & 0x000FFFFFFFFFFFFFULL) | 0x3FE0000000000000ULL);
+        double e = fromBits((u >> 52) | 0x4330000000000000ULL) - (4503599627370496.0 + 1022.0);
+        bool isSmall = m < M_SQRT1_2;
+        e = isSmall ? e - 1.0 : e;
+        double t = isSmall ? m + m - 1.0 : m - 1.0;
+        double z = t * t;
+        double p = ((((1.01875663804580931796E-4 * t + 4.97494994976747001425E-1) * t + 4.70579119878881725854E0) * t
+                     + 1.44989225341610930846E1) * t + 1.79368678507819816313E1) * t + 7.70838733755885391666E0;
+        double q = ((((t + 1.12873587189167450590E1) * t + 4.52279145837532221105E1) * t
+                     + 8.29875266912776603211E1) * t + 7.11544750618563894466E1) * t + 2.31251620126765340583E1;
+        double y = t * (z * p / q);
+        y -= e * 2.121944400546905827679e-4;
+        y -= 0.5 * z;
+        y = t + y;
+        y += e * 0.693359375;
+        return (x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max()) ? y : NaN;
+    }
+
+    RANDLIB_LANE_INLINE static float value(float x)
+    {
+        unsigned int u = toBits(x);
+        float m = fromBits((u & 0x007FFFFFu) | 0x3F000000u);
+        float e = fromBits((u >> 23) | 0x4B000000u) - (8388608.0f + 126.0f);
+        bool isSmall = m < static_cast<float>(M_SQRT1_2);
+        e = isSmall ? e - 1.0f : e;
+        float t = isSmall ? m + m - 1.0f : m - 1.0f;
+        float z = t * t;
+        float y = ((((((((7.0376836292E-2f * t - 1.1514610310E-1f) * t + 1.1676998740E-1f) * t
+                       - 1.2420140846E-1f) * t + 1.4249322787E-1f) * t - 1.6668057665E-1f) * t
+                    + 2.0000714765E-1f) * t - 2.4999993993E-1f) * t + 3.3333331174E-1f) * t * z;
+        y -= e * 2.12194440e-4f;
+        y -= 0.5f * z;
+        y = t + y;
+        y += e * 0.693359375f;
+        return (x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()) ? y : NaNF;
+    }
+
+    template < typename T >
+    static T fallback(T x) { return std::log(x); }
+};
+
+/**
+ * @brief The Log1pLane struct
+ * rational approximation for sqrt(1/2) <= 1 + x < sqrt(2) (Cephes),
+ * otherwise log(u) + (x - (u - 1)) / u, where u = 1 + x is rounded
+ */
+struct Log1pLane
+{
+    RANDLIB_LANE_INLINE static double value(double x)
+    {
+        double u = 1.0 + x;
+        double z = x * x;
+        double p = (((((4.5270000862445199635215E-5 * x + 4.9854102823193375972212E-1) * x + 6.5787325942061044846969E0) * x
+                      + 2.9911919328553073277375E1) * x + 6.0949667980987787057556E1) * x + 5.7112963590585538103336E1) * x
+                   + 2.0039553499201281259648E1;
+        double q = (((((x + 1.5062909083469192043167E1) * x + 8.3047565967967209469434E1) * x + 2.2176239823732856465394E2) * x
+                     + 3.0909872225312059774938E2) * x + 2.1642788614495947685003E2) * x + 6.0118660497603843919306E1;
+        double yNear = x + (x * (z * p / q) - 0.5 * z);
+        double yFar = LogLane::value(u) + (x - (u - 1.0)) / u;
+        double y = (u >= M_SQRT1_2 && u <= M_SQRT2) ? yNear : yFar;
+        return (x > -1.0 && x <= std::numeric_limits<double>::max()) ? y : NaN;
+    }
+
+    RANDLIB_LANE_INLINE static float value(float x) { return static_cast<float>(value(static_cast<double>(x))); }
+
+    template < typename T >
+    static T fallback(T x) { return std::log1p(x); }
+};
+
+/**
+ * @brief The Expm1Lane struct
+ * exp(x) - 1 = 2^k (exp(r) - 1) + (2^k - 1), |r| <= 1/2, k = 0 for |x| <= 1/2
+ * to avoid cancellation, and Taylor polynomial of exp(r) - 1
+ */
+struct Expm1Lane
+{
+    RANDLIB_LANE_INLINE static double value(double x)
+    {
+        static constexpr double C1 = 6.93145751953125E-1, C2 = 1.42860682030941723212E-6;
+        double kd = (std::fabs(x) <= 0.5) ? 0.0 : x * M_LOG2E;
+        kd += SHIFTER;
+        unsigned long long k = toBits(kd);
+        kd -= SHIFTER;
+        double r = x - kd * C1;
+        r -= kd * C2;
+        double y = expm1Taylor(r);
+        /// 2^k - 1 is exact for |k| <= 53
+        double scale = fromBits((k << 52) + 0x3FF0000000000000ULL);
+        y = (kd == 0.0) ? y : scale * y + (scale - 1.0);
+        y = (std::fabs(x) < 708.0) ? y : NaN;
+        /// exp(x) is below half of the unit roundoff for x < -38
+        y = (x <= -708.0) ? -1.0 : y;
+        return (x > 710.0) ? INFINITY : y;
+    }
+
+    RANDLIB_LANE_INLINE static float value(float x) { return static_cast<float>(value(static_cast<double>(x))); }
+
+    template < typename T >
+    static T fallback(T x) { return std::expm1(x); }
+};
+
+/**
+ * @brief The SinCosLane struct
+ * reduction of |x| by the nearest multiple of π/2, given as a sum of three parts,
+ * and polynomial approximations of sin and cos on [-π/4, π/4] (Cephes).
+ * Quadrant chooses the polynomial and the sign by bit masks, as integer comparisons
+ * of 64-bit lanes are missing in SSE2
+ */
+template < bool IS_COSINE >
+struct SinCosLane
+{
+    RANDLIB_LANE_INLINE static double value(double x)
+    {
+        static constexpr double DP1 = 7.85398125648498535156E-1, DP2 = 3.77489470793079817668E-8, DP3 = 2.69515142907905952645E-15;
+        double absX = std::fabs(x);
+        double q = absX * M_2_PI + SHIFTER;
+        unsigned long long quadrant = toBits(q);
+        q -= SHIFTER;
+        double y = q + q;
+        double z = ((absX - y * DP1) - y * DP2) - y * DP3;
+        double zz = z * z;
+        double sinPoly = z + z * (zz * (((((1.58962301576546568060E-10 * zz - 2.50507477628578072866E-8) * zz
+                                         + 2.75573136213857245213E-6) * zz - 1.98412698295895385996E-4) * zz
+                                       + 8.33333333332211858878E-3) * zz - 1.66666666666666307295E-1));
+        double cosPoly = 1.0 - 0.5 * zz + zz * zz * (((((-1.13585365213876817300E-11 * zz + 2.08757008419747316778E-9) * zz
+                                                       - 2.75573141792967388112E-7) * zz + 2.48015872888517045348E-5) * zz
+                                                     - 1.38888888888730564116E-3) * zz + 4.16666666666665929218E-2);
+        /// in odd quadrants sin and cos swap
+        unsigned long long swapMask = 0 - (quadrant & 1);
+        unsigned long long sinBits = toBits(sinPoly), cosBits = toBits(cosPoly), signBit;
+        if (IS_COSINE) {
+            y = fromBits((sinBits & swapMask) | (cosBits & ~swapMask));
+            signBit = ((quadrant + 1) & 2) << 62;
+        }
+        else {
+            y = fromBits((cosBits & swapMask) | (sinBits & ~swapMask));
+            signBit = ((quadrant & 2) << 62) ^ (toBits(x) & 0x8000000000000000ULL);
+        }
+        y = fromBits(toBits(y) ^ signBit);
+        return (absX < 65536.0) ? y : NaN;
+    }
+
+    RANDLIB_LANE_INLINE static float value(float x) { return static_cast<float>(value(static_cast<double>(x))); }
+
+    template < typename T >
+    static T fallback(T x) { return IS_COSINE ? std::cos(x) : std::sin(x); }
+};
+
+/**
+ * @brief The PowLane struct
+ * x^p = exp(p log(x)), where log(x) and the product are kept in double-double arithmetic,
+ * so that the error of the exponent doesn't grow with its magnitude
+ */
+struct PowLane
+{
+    /// Dekker's exact sum and product, the latter with Veltkamp's splitting
+    RANDLIB_LANE_INLINE static void twoSum(double a, double b, double &s, double &e)
+    {
+        s = a + b;
+        double bb = s - a;
+        e = (a - (s - bb)) + (b - bb);
+    }
+
+    RANDLIB_LANE_INLINE static void twoProd(double a, double b, double &p, double &e)
+    {
+        p = a * b;
+        double t = 134217729.0 * a;
+        double aHi = t - (t - a), aLo = a - aHi;
+        t = 134217729.0 * b;
+        double bHi = t - (t - b), bLo = b - bHi;
+        e = ((aHi * bHi - p) + aHi * bLo + aLo * bHi) + aLo * bLo;
+    }
+
+    RANDLIB_LANE_INLINE static double value(double x, double p)
+    {
+        static constexpr double LN2HI = 6.93147180369123816490e-01, LN2LO = 1.90821492927058770002e-10;
+        static constexpr double TWO_THIRDS_HI = 2.0 / 3, TWO_THIRDS_LO = 3.700743415417188e-17; ///< 2/3 - TWO_THIRDS_HI
+        unsigned long long u = toBits(x);
+        /// x = 2^e * m, sqrt(1/2) <= m < sqrt(2)
+        double m = fromBits((u & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL);
+        double e = fromBits((u >> 52) | 0x4330000000000000ULL) - (4503599627370496.0 + 1023.0);
+        bool isLarge = m > M_SQRT2;
+        m = isLarge ? 0.5 * m : m;
+        e = isLarge ? e + 1.0 : e;
+        /// log(m) = 2 atanh(s), s = (m - 1) / (m + 1) = sHi + sLo
+        double num = m - 1.0, denHi, denLo;
+        twoSum(m, 1.0, denHi, denLo);
+        double sHi = num / denHi, prodHi, prodLo;
+        twoProd(sHi, denHi, prodHi, prodLo);
+        double sLo = (((num - prodHi) - prodLo) - sHi * denLo) / denHi;
+        /// s^3 = cHi + cLo, its term 2/3 s^3 is up to 1% of the result, hence kept in double-double
+        double wHi, wLo, cHi, cLo;
+        twoProd(sHi, sHi, wHi, wLo);
+        twoProd(wHi, sHi, cHi, cLo);
+        cLo += wLo * sHi + 3.0 * wHi * sLo;
+        double cubicHi, cubicLo;
+        twoProd(cHi, TWO_THIRDS_HI, cubicHi, cubicLo);
+        cubicLo += cHi * TWO_THIRDS_LO + cLo * TWO_THIRDS_HI;
+        /// 2/5 + 2/7 w + ... + 2/25 w^10, next term is below 2^-66 of the result
+        double w = wHi;
+        double r = 2.0 / 25;
+        r = r * w + 2.0 / 23;
+        r = r * w + 2.0 / 21;
+        r = r * w + 2.0 / 19;
+        r = r * w + 2.0 / 17;
+        r = r * w + 2.0 / 15;
+        r = r * w + 2.0 / 13;
+        r = r * w + 2.0 / 11;
+        r = r * w + 2.0 / 9;
+        r = r * w + 2.0 / 7;
+        r = r * w + 2.0 / 5;
+        /// log(x) = e log(2) + 2 s + 2/3 s^3 + ...
+        double logHi, logLo, sum, sumLo;
+        twoSum(e * LN2HI, 2.0 * sHi, logHi, logLo);
+        twoSum(logHi, cubicHi, sum, sumLo);
+        logHi = sum;
+        logLo += sumLo + e * LN2LO + 2.0 * sLo + cubicLo + cHi * w * r;
+        sum = logHi + logLo;
+        logLo -= sum - logHi;
+        logHi = sum;
+        /// p * log(x) = tHi + tLo
+        double tHi, tLo;
+        twoProd(p, logHi, tHi, tLo);
+        tLo += p * logLo;
+        sum = tHi + tLo;
+        tLo -= sum - tHi;
+        tHi = sum;
+        double y = ExpLane::value(tHi);
+        y += y * tLo;
+        bool isRegular = x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max()
+                         && std::fabs(p) < 0x1p900;
+        return isRegular ? y : NaN;
+    }
+
+    RANDLIB_LANE_INLINE static float value(float x, float p)
+    {
+        return static_cast<float>(value(static_cast<double>(x), static_cast<double>(p)));
+    }
+
+    template < typename T >
+    static T fallback(T x, T p) { return std::pow(x, p); }
+};
+
+/**
+ * @brief The PowScalarLane struct
+ * power with the same exponent for all elements
+ */
+template < typename T >
+struct PowScalarLane
+{
+    T p;
+    RANDLIB_LANE_INLINE T value(T x) const { return PowLane::value(x, p); }
+    T fallback(T x) const { return std::pow(x, p); }
+};
+
+template < typename T >
+constexpr size_t blockSize() { return 128 / sizeof(T); }
+
+/**
+ * @fn mapBlocks
+ * y[i] = lane.value(x[i]) block by block: copies to local arrays let the compiler vectorize
+ * loops of fixed length without alias checks, the rest of the last block is padded by ones
+ * @param lane
+ * @param x
+ * @param y
+ * @param n
+ */
+template < class Lane, typename T >
+RANDLIB_LANE_INLINE inline void mapBlocks(const Lane &lane, const T *x, T *y, size_t n)
+{
+    constexpr size_t BLOCK = blockSize<T>();
+    alignas(64) T in[BLOCK], out[BLOCK];
+    for (size_t i = 0; i < n; i += BLOCK) {
+        size_t size = std::min(BLOCK, n - i);
+        std::copy(x + i, x + i + size, in);
+        std::fill(in + size, in + BLOCK, T(1));
+        for (size_t j = 0; j != BLOCK; ++j)
+            out[j] = lane.value(in[j]);
+        for (size_t j = 0; j != size; ++j) {
+            if (out[j] != out[j])
+                out[j] = lane.fallback(in[j]);
+        }
+        std::copy(out, out + size, y + i);
+    }
+}
+
+/**
+ * @fn mapBlocks
+ * y[i] = Lane::value(x[i], p[i]) block by block
+ * @param x
+ * @param p
+ * @param y
+ * @param n
+ */
+template < class Lane, typename T >
+RANDLIB_LANE_INLINE inline void mapBlocks(const T *x, const T *p, T *y, size_t n)
+{
+    constexpr size_t BLOCK = blockSize<T>();
+    alignas(64) T in[BLOCK], param[BLOCK], out[BLOCK];
+    for (size_t i = 0; i < n; i += BLOCK) {
+        size_t size = std::min(BLOCK, n - i);
+        std::copy(x + i, x + i + size, in);
+        std::fill(in + size, in + BLOCK, T(1));
+        std::copy(p + i, p + i + size, param);
+        std::fill(param + size, param + BLOCK, T(1));
+        for (size_t j = 0; j != BLOCK; ++j)
+            out[j] = Lane::value(in[j], param[j]);
+        for (size_t j = 0; j != size; ++j) {
+            if (out[j] != out[j])
+                out[j] = Lane::fallback(in[j], param[j]);
+        }
+        std::copy(out, out + size, y + i);
+    }
+}
+
+template < class Lane, typename T >
+using UnaryKernelPtr = void (*)(const Lane &, const T *, T *, size_t);
+
+template < class Lane, typename T >
+using BinaryKernelPtr = void (*)(const T *, const T *, T *, size_t);
+
+template < class Lane, typename T >
+void unaryKernel(const Lane &lane, const T *x, T *y, size_t n)
+{
+    mapBlocks(lane, x, y, n);
+}
+
+template < class Lane, typename T >
+void binaryKernel(const T *x, const T *p, T *y, size_t n)
+{
+    mapBlocks<Lane>(x, p, y, n);
+}
+
+#ifdef RANDLIB_VECTORMATH_DISPATCH
+/// The same kernels, compiled for wider vector units.
+/// There is no FMA and no reassociation, so every version gives the same bits
+template < class Lane, typename T >
+__attribute__((target("avx2"))) void unaryKernelAVX2(const Lane &lane, const T *x, T *y, size_t n)
+{
+    mapBlocks(lane, x, y, n);
+}
+
+template < class Lane, typename T >
+__attribute__((target("avx512f"))) void unaryKernelAVX512(const Lane &lane, const T *x, T *y, size_t n)
+{
+    mapBlocks(lane, x, y, n);
+}
+
+template < class Lane, typename T >
+__attribute__((target("avx2"))) void binaryKernelAVX2(const T *x, const T *p, T *y, size_t n)
+{
+    mapBlocks<Lane>(x, p, y, n);
+}
+
+template < class Lane, typename T >
+__attribute__((target("avx512f"))) void binaryKernelAVX512(const T *x, const T *p, T *y, size_t n)
+{
+    mapBlocks<Lane>(x, p, y, n);
+}
+#endif
+
+template < class Lane, typename T >
+UnaryKernelPtr<Lane, T> chooseUnaryKernel()
+{
+#ifdef RANDLIB_VECTORMATH_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return unaryKernelAVX512<Lane, T>;
+    if (__builtin_cpu_supports("avx2"))
+        return unaryKernelAVX2<Lane, T>;
+#endif
+    return unaryKernel<Lane, T>;
+}
+
+template < class Lane, typename T >
+BinaryKernelPtr<Lane, T> chooseBinaryKernel()
+{
+#ifdef RANDLIB_VECTORMATH_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return binaryKernelAVX512<Lane, T>;
+    if (__builtin_cpu_supports("avx2"))
+        return binaryKernelAVX2<Lane, T>;
+#endif
+    return binaryKernel<Lane, T>;
+}
+
+template < class Lane, typename T >
+void applyUnary(const Lane &lane, const T *x, T *y, size_t n)
+{
+#ifdef RANDLIB_SCALAR_MATH
+    for (size_t i = 0; i != n; ++i)
+        y[i] = lane.fallback(x[i]);
+#else
+    static const UnaryKernelPtr<Lane, T> kernel = chooseUnaryKernel<Lane, T>();
+    kernel(lane, x, y, n);
+#endif
+}
+
+template < class Lane, typename T >
+void applyBinary(const T *x, const T *p, T *y, size_t n)
+{
+#ifdef RANDLIB_SCALAR_MATH
+    for (size_t i = 0; i != n; ++i)
+        y[i] = Lane::fallback(x[i], p[i]);
+#else
+    static const BinaryKernelPtr<Lane, T> kernel = chooseBinaryKernel<Lane, T>();
+    kernel(x, p, y, n);
+#endif
+}
+
+}
+
+namespace RandMath
+{
+
+void vexp(const double *x, double *y, size_t n)
+{
+    applyUnary(ExpLane(), x, y, n);
+}
+
+void vexp(const float *x, float *y, size_t n)
+{
+    applyUnary(ExpLane(), x, y, n);
+}
+
+void vexp(const long double *x, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::exp(x[i]);
+}
+
+void vlog(const double *x, double *y, size_t n)
+{
+    applyUnary(LogLane(), x, y, n);
+}
+
+void vlog(const float *x, float *y, size_t n)
+{
+    applyUnary(LogLane(), x, y, n);
+}
+
+void vlog(const long double *x, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::log(x[i]);
+}
+
+void vlog1p(const double *x, double *y, size_t n)
+{
+    applyUnary(Log1pLane(), x, y, n);
+}
+
+void vlog1p(const float *x, float *y, size_t n)
+{
+    applyUnary(Log1pLane(), x, y, n);
+}
+
+void vlog1p(const long double *x, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::log1p(x[i]);
+}
+
+void vexpm1(const double *x, double *y, size_t n)
+{
+    applyUnary(Expm1Lane(), x, y, n);
+}
+
+void vexpm1(const float *x, float *y, size_t n)
+{
+    applyUnary(Expm1Lane(), x, y, n);
+}
+
+void vexpm1(const long double *x, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::expm1(x[i]);
+}
+
+void vsin(const double *x, double *y, size_t n)
+{
+    applyUnary(SinCosLane<false>(), x, y, n);
+}
+
+void vsin(const float *x, float *y, size_t n)
+{
+    applyUnary(SinCosLane<false>(), x, y, n);
+}
+
+void vsin(const long double *x, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::sin(x[i]);
+}
+
+void vcos(const double *x, double *y, size_t n)
+{
+    applyUnary(SinCosLane<true>(), x, y, n);
+}
+
+void vcos(const float *x, float *y, size_t n)
+{
+    applyUnary(SinCosLane<true>(), x, y, n);
+}
+
+void vcos(const long double *x, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::cos(x[i]);
+}
+
+void vpow(const double *x, const double *p, double *y, size_t n)
+{
+    applyBinary<PowLane>(x, p, y, n);
+}
+
+void vpow(const float *x, const float *p, float *y, size_t n)
+{
+    applyBinary<PowLane>(x, p, y, n);
+}
+
+void vpow(const long double *x, const long double *p, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::pow(x[i], p[i]);
+}
+
+void vpow(const double *x, double p, double *y, size_t n)
+{
+    applyUnary(PowScalarLane<double>{p}, x, y, n);
+}
+
+void vpow(const float *x, float p, float *y, size_t n)
+{
+    applyUnary(PowScalarLane<float>{p}, x, y, n);
+}
+
+void vpow(const long double *x, long double p, long double *y, size_t n)
+{
+    for (size_t i = 0; i != n; ++i)
+        y[i] = std::pow(x[i], p);
+}
+
+}
@@ -0,0 +1,133 @@
+#ifndef VECTORMATH_H
+#define VECTORMATH_H
+
+#include <cstddef>
+
+/// Elementary functions on arrays, used by batch evaluators and samplers.
+///
+/// Each function computes y[i] = f(x[i]) for i = 0, ..., n - 1; y may coincide with x.
+/// Arrays are processed in blocks of 16 doubles or 32 floats by branch-free polynomial
+/// kernels, which are compiled for SSE2 (2 doubles / 4 floats per register on x86-64),
+/// AVX2 (4 / 8) and AVX-512 (8 / 16), and the widest one supported by the processor
+/// is chosen at runtime. Elsewhere the same kernels are compiled for the default target.
+/// Kernels use neither FMA nor lookup tables, so results are bit-identical on every
+/// instruction set. Arguments out of the kernel's range (NaN, subnormals, results close
+/// to underflow or overflow, huge arguments of sin and cos) are passed to the scalar
+/// functions of <cmath>.
+/// Defining RANDLIB_SCALAR_MATH turns every function into a loop over <cmath>.
+///
+/// Maximum errors in ULP (units in the last place) of double / float results,
+/// measured against long double functions on 10^6 random arguments, which are passed
+/// to the kernels:
+///
+/// | function | double | float | arguments of the kernel                          |
+/// |----------|--------|-------|--------------------------------------------------|
+/// | vexp     | 0.95   | 0.97  | |x| < 708 (87 for float)                         |
+/// | vlog     | 0.91   | 0.80  | normal positive x                                |
+/// | vlog1p   | 1.05   | 0.5   | x > -1                                           |
+/// | vexpm1   | 1.13   | 0.5   | |x| < 708                                        |
+/// | vsin     | 1.54 * | 0.5   | |x| < 2^16                                       |
+/// | vcos     | 1.51 * | 0.5   | |x| < 2^16                                       |
+/// | vpow     | 1.47   | 0.5   | normal positive x, |p| < 2^900                    |
+///
+/// * sin and cos are evaluated after reduction by π/2, given with about 100 bits,
+/// hence close to zeros of the functions for large |x| the bound is absolute (about 2^-53).
+/// Float versions of log1p, expm1, sin, cos and pow are computed in double lanes.
+/// Long double versions are loops over <cmath>, they let templates of the library
+/// call these functions for any RealType.
+
+namespace RandMath
+{
+
+/// Length of local buffers for intermediate arrays of batch evaluators
+constexpr size_t VECTOR_MATH_BUFFER_SIZE = 256;
+
+/// Length of blocks, in which special functions on arrays run their series:
+/// loops of fixed length over a block are vectorized by the compiler
+constexpr size_t VECTOR_MATH_BLOCK_SIZE = 16;
+
+/**
+ * @fn vexp
+ * @param x
+ * @param y y[i] = exp(x[i])
+ * @param n
+ */
+void vexp(const double *x, double *y, size_t n);
+void vexp(const float *x, float *y, size_t n);
+void vexp(const long double *x, long double *y, size_t n);
+
+/**
+ * @fn vlog
+ * @param x
+ * @param y y[i] = log(x[i])
+ * @param n
+ */
+void vlog(const double *x, double *y, size_t n);
+void vlog(const float *x, float *y, size_t n);
+void vlog(const long double *x, long double *y, size_t n);
+
+/**
+ * @fn vlog1p
+ * @param x
+ * @param y y[i] = log(1 + x[i])
+ * @param n
+ */
+void vlog1p(const double *x, double *y, size_t n);
+void vlog1p(const float *x, float *y, size_t n);
+void vlog1p(const long double *x, long double *y, size_t n);
+
+/**
+ * @fn vexpm1
+ * @param x
+ * @param y y[i] = exp(x[i]) - 1
+ * @param n
+ */
+void vexpm1(const double *x, double *y, size_t n);
+void vexpm1(const float *x, float *y, size_t n);
+void vexpm1(const long double *x, long double *y, size_t n);
+
+/**
+ * @fn vsin
+ * @param x
+ * @param y y[i] = sin(x[i])
+ * @param n
+ */
+void vsin(const double *x, double *y, size_t n);
+void vsin(const float *x, float *y, size_t n);
+void vsin(const long double *x, long double *y, size_t n);
+
+/**
+ * @fn vcos
+ * @param x
+ * @param y y[i] = cos(x[i])
+ * @param n
+ */
+void vcos(const double *x, double *y, size_t n);
+void vcos(const float *x, float *y, size_t n);
+void vcos(const long double *x, long double *y, size_t n);
+
+/**
+ * @fn vpow
+ * @param x
+ * @param p
+ * @param y y[i] = x[i]^p[i]
+ * @param n
+ */
+void vpow(const double *x, const double *p, double *y, size_t n);
+void vpow(const float *x, const float *p, float *y, size_t n);
+void vpow(const long double *x, const long double *p, long double *y, size_t n);
+
+/**
+ * @fn vpow
+ * @param x
+ * @param p
+ * @param y y[i] = x[i]^p
+ * @param n
+ */
+void vpow(const double *x, double p, double *y, size_t n);
+void vpow(const float *x, float p, float *y, size_t n);
+void vpow(const long double *x, long double p, long double *y, size_t n);
+
+}
+
+#endif // VECTORMATH_H
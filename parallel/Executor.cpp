@@ -0,0 +1,174 @@
+#include "Executor.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+std::atomic<Executor *> Executor::injected{nullptr};
+
+Executor &Executor::Default()
+{
+    Executor *executor = injected.load();
+    if (executor != nullptr)
+        return *executor;
+    static WorkStealingExecutor pool;
+    return pool;
+}
+
+void Executor::SetDefault(Executor *executor)
+{
+    injected.store(executor);
+}
+
+thread_local const WorkStealingExecutor *WorkStealingExecutor::currentPool = nullptr;
+thread_local size_t WorkStealingExecutor::currentQueue = 0;
+
+WorkStealingExecutor::WorkStealingExecutor(size_t threads, bool pinThreads) :
+    threadsNum(threads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : threads)
+{
+    for (size_t i = 0; i != threadsNum; ++i)
+        queues.push_back(std::make_unique<Queue>());
+    for (size_t i = 0; i + 1 < threadsNum; ++i) {
+        workers.emplace_back([this, i, pinThreads] ()
+        {
+            if (pinThreads)
+                pinCurrentThread(i);
+            workerLoop(i);
+        });
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+void WorkStealingExecutor::pinCurrentThread(size_t cpu)
+{
+#ifdef __linux__
+    size_t coresNum = std::max(std::thread::hardware_concurrency(), 1u);
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu % coresNum, &cpuSet);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+#else
+    (void)cpu;
+#endif
+}
+
+void WorkStealingExecutor::push(size_t queueIndex, const Range &range)
+{
+    Queue &queue = *queues[queueIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.push_back(range);
+    }
+    {
+        /// counter is changed under the lock, so that sleeping workers don't miss it
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        ++queuedNum;
+    }
+    wakeUp.notify_one();
+}
+
+bool WorkStealingExecutor::pop(size_t queueIndex, Range &range)
+{
+    for (size_t i = 0; i != threadsNum; ++i) {
+        Queue &queue = *queues[(queueIndex + i) % threadsNum];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.ranges.empty())
+            continue;
+        if (i == 0) {
+            range = queue.ranges.back();
+            queue.ranges.pop_back();
+        }
+        else {
+            range = queue.ranges.front();
+            queue.ranges.pop_front();
+        }
+        --queuedNum;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingExecutor::run(size_t queueIndex, Range range)
+{
+    Job &job = *range.job;
+    while (range.end - range.begin > 1) {
+        size_t middle = range.begin + (range.end - range.begin) / 2;
+        push(queueIndex, {range.job, middle, range.end});
+        range.end = middle;
+    }
+    if (!job.failed) {
+        try {
+            (*job.task)(range.begin);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if (!job.failed.exchange(true))
+                job.exception = std::current_exception();
+        }
+    }
+    /// the job can be destroyed by the caller right after the last decrement,
+    /// hence only the pool is touched afterwards
+    if (job.remaining.fetch_sub(1) == 1) {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wakeUp.notify_all();
+    }
+}
+
+void WorkStealingExecutor::workerLoop(size_t queueIndex)
+{
+    currentPool = this;
+    currentQueue = queueIndex;
+    Range range{nullptr, 0, 0};
+    while (true) {
+        if (pop(queueIndex, range)) {
+            run(queueIndex, range);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this] { return stopping || queuedNum > 0; });
+        if (stopping)
+            return;
+    }
+}
+
+void WorkStealingExecutor::ParallelFor(size_t tasksNum, const std::function<void (size_t)> &task)
+{
+    if (threadsNum == 1 || tasksNum <= 1) {
+        for (size_t i = 0; i != tasksNum; ++i)
+            task(i);
+        return;
+    }
+    /// threads outside of the pool share the last queue
+    size_t queueIndex = (currentPool == this) ? currentQueue : threadsNum - 1;
+    Job job;
+    job.task = &task;
+    job.remaining = tasksNum;
+    push(queueIndex, {&job, 0, tasksNum});
+    /// help with any tasks, while ours are not done: threads, which stole our ranges,
+    /// can push their upper halves after our queue became empty, and nobody else
+    /// might be free to take them, if all workers wait in nested calls
+    Range range{nullptr, 0, 0};
+    while (job.remaining > 0) {
+        if (pop(queueIndex, range)) {
+            run(queueIndex, range);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this, &job] { return queuedNum > 0 || job.remaining == 0; });
+    }
+    if (job.exception)
+        std::rethrow_exception(job.exception);
+}
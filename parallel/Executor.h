@@ -0,0 +1,165 @@
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RandLib_global.h"
+
+/**
+ * @brief The Executor class
+ * Interface of thread pools, which run parallel parts of the library.
+ * All of them go through Executor::Default(), so one pool is shared
+ * instead of each call starting its own threads. Callers can inject
+ * their own implementation by SetDefault
+ */
+class RANDLIBSHARED_EXPORT Executor
+{
+    static std::atomic<Executor *> injected;
+
+public:
+    virtual ~Executor() {}
+
+    /**
+     * @fn ThreadsNum
+     * @return amount of threads, which can run tasks at once,
+     * including the calling thread
+     */
+    virtual size_t ThreadsNum() const = 0;
+
+    /**
+     * @fn ParallelFor
+     * runs task(i) for i = 0, ..., tasksNum - 1 in any order and on any threads
+     * and returns when all of them are done. If some of tasks throw,
+     * the rest of them might be skipped and the first exception is rethrown
+     * @param tasksNum
+     * @param task
+     */
+    virtual void ParallelFor(size_t tasksNum, const std::function<void (size_t)> &task) = 0;
+
+    /**
+     * @fn Default
+     * @return executor, set by SetDefault, or the built-in work-stealing pool
+     * with a thread per core, which is started on the first call
+     */
+    static Executor &Default();
+
+    /**
+     * @fn SetDefault
+     * @param executor pointer on the executor, which should be used by the library,
+     * nullptr restores the built-in pool. The caller keeps ownership and
+     * the executor should outlive all calls of the library, which use it
+     */
+    static void SetDefault(Executor *executor);
+};
+
+/**
+ * @brief The WorkStealingExecutor class
+ * Fixed pool of threads with a queue per thread. Range of tasks is split in halves:
+ * a thread keeps the lower half and pushes the upper one to the back of its own queue.
+ * Idle threads take from the back of their own queue (the most recent and smallest part)
+ * or steal from the front of others' (the oldest and largest part),
+ * so work is spread in O(log n) steals. A thread, which waits for ParallelFor,
+ * runs tasks meanwhile, therefore nested calls don't deadlock
+ */
+class RANDLIBSHARED_EXPORT WorkStealingExecutor final : public Executor
+{
+    struct Job
+    {
+        const std::function<void (size_t)> *task = nullptr;
+        std::atomic<size_t> remaining{0}; ///< amount of task indices, which are not done yet
+        std::atomic<bool> failed{false};
+        std::exception_ptr exception{};
+        std::mutex mutex{}; ///< guards the exception
+    };
+
+    struct Range
+    {
+        Job *job;
+        size_t begin;
+        size_t end;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex{};
+        std::deque<Range> ranges{};
+    };
+
+    size_t threadsNum = 1;
+    /// queue of each worker and the last one for threads outside of the pool
+    std::vector<std::unique_ptr<Queue>> queues{};
+    std::vector<std::thread> workers{};
+    std::atomic<size_t> queuedNum{0}; ///< amount of ranges in all queues
+    std::mutex sleepMutex{};
+    /// notified by push and by the last task of each job, so that both idle workers
+    /// and threads waiting in ParallelFor react on new ranges and finished jobs
+    std::condition_variable wakeUp{};
+    bool stopping = false;
+
+    /// pool and index of the queue of the worker, which runs on current thread
+    static thread_local const WorkStealingExecutor *currentPool;
+    static thread_local size_t currentQueue;
+
+    /**
+     * @fn push
+     * @param queueIndex
+     * @param range
+     */
+    void push(size_t queueIndex, const Range &range);
+
+    /**
+     * @fn pop
+     * takes range from the back of own queue or from the front of any other one
+     * @param queueIndex
+     * @param range
+     * @return true if there was one
+     */
+    bool pop(size_t queueIndex, Range &range);
+
+    /**
+     * @fn run
+     * splits the range, until one task remains, and runs it
+     * @param queueIndex
+     * @param range
+     */
+    void run(size_t queueIndex, Range range);
+
+    /**
+     * @fn workerLoop
+     * @param queueIndex
+     */
+    void workerLoop(size_t queueIndex);
+
+    /**
+     * @fn pinCurrentThread
+     * @param cpu
+     */
+    static void pinCurrentThread(size_t cpu);
+
+public:
+    /**
+     * @brief WorkStealingExecutor
+     * @param threads amount of threads including the calling one,
+     * thread per core by default. One thread means sequential execution
+     * @param pinThreads bind worker i to core i (only Linux, ignored elsewhere)
+     */
+    explicit WorkStealingExecutor(size_t threads = 0, bool pinThreads = false);
+    ~WorkStealingExecutor();
+
+    WorkStealingExecutor(const WorkStealingExecutor &) = delete;
+    WorkStealingExecutor &operator=(const WorkStealingExecutor &) = delete;
+
+    size_t ThreadsNum() const override { return threadsNum; }
+    void ParallelFor(size_t tasksNum, const std::function<void (size_t)> &task) override;
+};
+
+#endif // EXECUTOR_H